@@ -500,7 +500,7 @@ ifeq ($(strip $(BACKLIGHT_ENABLE)), yes)
     endif
 endif
 
-VALID_WS2812_DRIVER_TYPES := bitbang pwm spi i2c
+VALID_WS2812_DRIVER_TYPES := bitbang pwm spi i2c gpio_dma
 
 WS2812_DRIVER ?= bitbang
 ifeq ($(strip $(WS2812_DRIVER_REQUIRED)), yes)
@@ -516,7 +516,7 @@ ifeq ($(strip $(WS2812_DRIVER_REQUIRED)), yes)
         SRC += ws2812_$(strip $(WS2812_DRIVER)).c
 
         ifeq ($(strip $(PLATFORM)), CHIBIOS)
-            ifeq ($(strip $(WS2812_DRIVER)), pwm)
+            ifneq ($(filter $(WS2812_DRIVER),pwm gpio_dma),)
                 OPT_DEFS += -DSTM32_DMA_REQUIRED=TRUE
             endif
         endif
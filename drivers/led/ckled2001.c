@@ -37,14 +37,70 @@ uint8_t g_twi_transfer_buffer[20];
 // The control buffers match the PG0 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in CKLED2001_write_pwm_buffer() but it's
+// buffers and the transfers in CKLED2001_write_dirty_pwm_blocks() but it's
 // probably not worth the extra complexity.
 uint8_t g_pwm_buffer[DRIVER_COUNT][192];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+
+// One bit per 16 byte block of the PWM buffers, set when a value in the block changed.
+// Everything starts dirty, so the first update writes the whole buffer.
+#define CKLED2001_PWM_BLOCK_SIZE 16
+#define CKLED2001_PWM_BLOCK_COUNT (192 / CKLED2001_PWM_BLOCK_SIZE)
+uint16_t g_pwm_buffer_dirty_blocks[DRIVER_COUNT] = {[0 ... DRIVER_COUNT - 1] = (1U << CKLED2001_PWM_BLOCK_COUNT) - 1};
 
 uint8_t g_led_control_registers[DRIVER_COUNT][24]             = {0};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
 
+#ifdef I2C_ASYNC_ENABLE
+// PWM updates are only queued on the I2C thread. A failed transfer is flagged
+// from its completion callback, and the next update then resends everything.
+static volatile bool g_pwm_buffer_async_failed[DRIVER_COUNT] = {false};
+
+static void CKLED2001_async_complete(i2c_status_t status, void *arg) {
+    if (status != I2C_STATUS_SUCCESS) {
+        g_pwm_buffer_async_failed[(uintptr_t)arg] = true;
+    }
+}
+
+// A failing write is retried up to CKLED2001_PERSISTENCE times by the I2C thread
+static bool CKLED2001_queue_write(uint8_t addr, uint8_t index, uint8_t reg, const uint8_t *data, uint16_t length) {
+    return i2c_writeReg_async(addr << 1, reg, data, length, CKLED2001_TIMEOUT, CKLED2001_PERSISTENCE, CKLED2001_async_complete, (void *)(uintptr_t)index) == I2C_STATUS_SUCCESS;
+}
+
+static bool CKLED2001_queue_register(uint8_t addr, uint8_t index, uint8_t reg, uint8_t data) {
+    return CKLED2001_queue_write(addr, index, reg, &data, 1);
+}
+
+// Set for the drivers that had to wait for room in the I2C queue; the others
+// hold back until these have been queued.
+static uint8_t g_pwm_buffer_async_deferred = 0;
+
+// A PWM update is only queued as a whole, never left half done
+static bool CKLED2001_queue_pwm_update_fits(uint8_t index) {
+    if (g_pwm_buffer_async_deferred && !(g_pwm_buffer_async_deferred & (1U << index))) {
+        return false;
+    }
+
+    uint8_t  transfers = 1;
+    uint16_t bytes     = 2;
+    for (uint8_t block = 0; block < CKLED2001_PWM_BLOCK_COUNT; block++) {
+        if (g_pwm_buffer_dirty_blocks[index] & (1U << block)) {
+            if (block == 0 || !(g_pwm_buffer_dirty_blocks[index] & (1U << (block - 1)))) {
+                transfers++;
+                bytes++;
+            }
+            bytes += CKLED2001_PWM_BLOCK_SIZE;
+        }
+    }
+
+    if (!i2c_async_can_queue(transfers, bytes)) {
+        g_pwm_buffer_async_deferred |= 1U << index;
+        return false;
+    }
+    g_pwm_buffer_async_deferred &= ~(1U << index);
+    return true;
+}
+#endif
+
 bool CKLED2001_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     // If the transaction fails function returns false.
     g_twi_transfer_buffer[0] = reg;
@@ -64,33 +120,38 @@ bool CKLED2001_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     return true;
 }
 
-bool CKLED2001_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+bool CKLED2001_write_dirty_pwm_blocks(uint8_t addr, uint8_t index) {
     // Assumes PG1 is already selected.
-    // If any of the transactions fails function returns false.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
-    // g_twi_transfer_buffer[] is 20 bytes
-
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (int i = 0; i < 192; i += 16) {
-        g_twi_transfer_buffer[0] = i;
-        // Copy the data from i to i+15.
-        // Device will auto-increment register for data after the first byte
-        // Thus this sets registers 0x00-0x0F, 0x10-0x1F, etc. in one transfer.
-        for (int j = 0; j < 16; j++) {
-            g_twi_transfer_buffer[1 + j] = pwm_buffer[i + j];
+    // Runs of adjacent dirty blocks are sent as a single auto-increment transfer,
+    // blocks are only marked clean once they have been written.
+    for (uint8_t first = 0; first < CKLED2001_PWM_BLOCK_COUNT; first++) {
+        if (!(g_pwm_buffer_dirty_blocks[index] & (1U << first))) {
+            continue;
+        }
+        uint8_t last = first;
+        while (last + 1 < CKLED2001_PWM_BLOCK_COUNT && (g_pwm_buffer_dirty_blocks[index] & (1U << (last + 1)))) {
+            last++;
         }
 
-#if CKLED2001_PERSISTENCE > 0
+        uint8_t  reg    = first * CKLED2001_PWM_BLOCK_SIZE;
+        uint16_t length = (last - first + 1) * CKLED2001_PWM_BLOCK_SIZE;
+#if defined(I2C_ASYNC_ENABLE)
+        if (!CKLED2001_queue_write(addr, index, reg, &g_pwm_buffer[index][reg], length)) {
+            return false;
+        }
+#elif CKLED2001_PERSISTENCE > 0
         for (uint8_t i = 0; i < CKLED2001_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, CKLED2001_TIMEOUT) != 0) {
+            if (i2c_writeReg(addr << 1, reg, &g_pwm_buffer[index][reg], length, CKLED2001_TIMEOUT) != 0) {
                 return false;
             }
         }
 #else
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, CKLED2001_TIMEOUT) != 0) {
+        if (i2c_writeReg(addr << 1, reg, &g_pwm_buffer[index][reg], length, CKLED2001_TIMEOUT) != 0) {
             return false;
         }
 #endif
+        g_pwm_buffer_dirty_blocks[index] &= ~((1U << (last + 1)) - (1U << first));
+        first = last;
     }
     return true;
 }
@@ -149,15 +210,21 @@ void CKLED2001_init(uint8_t addr) {
     CKLED2001_write_register(addr, CONFIGURATION_REG, MSKSW_NORMAL_MODE);
 }
 
+static inline void CKLED2001_set_pwm_register(uint8_t driver, uint8_t reg, uint8_t value) {
+    if (g_pwm_buffer[driver][reg] != value) {
+        g_pwm_buffer[driver][reg] = value;
+        g_pwm_buffer_dirty_blocks[driver] |= 1U << (reg / CKLED2001_PWM_BLOCK_SIZE);
+    }
+}
+
 void CKLED2001_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     ckled2001_led led;
     if (index >= 0 && index < DRIVER_LED_TOTAL) {
         memcpy_P(&led, (&g_ckled2001_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        CKLED2001_set_pwm_register(led.driver, led.r, red);
+        CKLED2001_set_pwm_register(led.driver, led.g, green);
+        CKLED2001_set_pwm_register(led.driver, led.b, blue);
     }
 }
 
@@ -198,16 +265,33 @@ void CKLED2001_set_led_control_register(uint8_t index, bool red, bool green, boo
 }
 
 void CKLED2001_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+#ifdef I2C_ASYNC_ENABLE
+    if (g_pwm_buffer_async_failed[index]) {
+        g_pwm_buffer_async_failed[index]               = false;
+        g_pwm_buffer_dirty_blocks[index]               = (1U << CKLED2001_PWM_BLOCK_COUNT) - 1;
+        g_led_control_registers_update_required[index] = true;
+    }
+#endif
+    if (g_pwm_buffer_dirty_blocks[index]) {
+#ifdef I2C_ASYNC_ENABLE
+        if (!CKLED2001_queue_pwm_update_fits(index)) {
+            // Resumed by a later flush
+            return;
+        }
+        if (!CKLED2001_queue_register(addr, index, CONFIGURE_CMD_PAGE, LED_PWM_PAGE)) {
+            // The PWM page may not be selected, keep every block dirty
+            return;
+        }
+#else
         CKLED2001_write_register(addr, CONFIGURE_CMD_PAGE, LED_PWM_PAGE);
+#endif
 
         // If any of the transactions fail we risk writing dirty PG0,
-        // refresh page 0 just in case.
-        if (!CKLED2001_write_pwm_buffer(addr, g_pwm_buffer[index])) {
+        // refresh page 0 just in case. Blocks that were not written stay dirty.
+        if (!CKLED2001_write_dirty_pwm_blocks(addr, index)) {
             g_led_control_registers_update_required[index] = true;
         }
     }
-    g_pwm_buffer_update_required[index] = false;
 }
 
 void CKLED2001_update_led_control_registers(uint8_t addr, uint8_t index) {
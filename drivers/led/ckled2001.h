@@ -31,7 +31,7 @@ extern const ckled2001_led PROGMEM g_ckled2001_leds[DRIVER_LED_TOTAL];
 
 void CKLED2001_init(uint8_t addr);
 bool CKLED2001_write_register(uint8_t addr, uint8_t reg, uint8_t data);
-bool CKLED2001_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer);
+bool CKLED2001_write_dirty_pwm_blocks(uint8_t addr, uint8_t index);
 
 void CKLED2001_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void CKLED2001_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
@@ -41,7 +41,7 @@ void CKLED2001_set_led_control_register(uint8_t index, bool red, bool green, boo
 // This should not be called from an interrupt
 // (eg. from a timer interrupt).
 // Call this while idle (in between matrix scans).
-// If the buffer is dirty, it will update the driver with the buffer.
+// If the buffer is dirty, it will update the driver with the changed blocks of the buffer.
 void CKLED2001_update_pwm_buffers(uint8_t addr, uint8_t index);
 void CKLED2001_update_led_control_registers(uint8_t addr, uint8_t index);
 
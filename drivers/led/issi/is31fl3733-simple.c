@@ -94,6 +94,43 @@ uint8_t g_led_control_registers[LED_DRIVER_COUNT][24] = {{0}, {0}, {0}, {0}};
 #endif
 bool g_led_control_registers_update_required[LED_DRIVER_COUNT] = {false};
 
+#ifdef I2C_ASYNC_ENABLE
+// PWM updates are only queued on the I2C thread. A failed transfer is flagged
+// from its completion callback, and the next update then resends everything.
+static volatile bool g_pwm_buffer_async_failed[LED_DRIVER_COUNT] = {false};
+
+static void IS31FL3733_async_complete(i2c_status_t status, void *arg) {
+    if (status != I2C_STATUS_SUCCESS) {
+        g_pwm_buffer_async_failed[(uintptr_t)arg] = true;
+    }
+}
+
+// A failing write is retried up to ISSI_PERSISTENCE times by the I2C thread
+static bool IS31FL3733_queue_write(uint8_t addr, uint8_t index, uint8_t reg, const uint8_t *data, uint16_t length) {
+    return i2c_writeReg_async(addr << 1, reg, data, length, ISSI_TIMEOUT, ISSI_PERSISTENCE, IS31FL3733_async_complete, (void *)(uintptr_t)index) == I2C_STATUS_SUCCESS;
+}
+
+static bool IS31FL3733_queue_register(uint8_t addr, uint8_t index, uint8_t reg, uint8_t data) {
+    return IS31FL3733_queue_write(addr, index, reg, &data, 1);
+}
+
+// Drivers left out of a flush because the queue was full are updated before the others
+static uint8_t g_pwm_buffer_async_deferred = 0;
+
+static bool IS31FL3733_queue_pwm_update_fits(uint8_t index) {
+    if (g_pwm_buffer_async_deferred && !(g_pwm_buffer_async_deferred & (1U << index))) {
+        return false;
+    }
+    // Unlock, page select and the 192 PWM registers
+    if (!i2c_async_can_queue(3, 2 * 2 + 1 + 192)) {
+        g_pwm_buffer_async_deferred |= 1U << index;
+        return false;
+    }
+    g_pwm_buffer_async_deferred &= ~(1U << index);
+    return true;
+}
+#endif
+
 bool IS31FL3733_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     // If the transaction fails function returns false.
     g_twi_transfer_buffer[0] = reg;
@@ -221,6 +258,20 @@ void IS31FL3733_set_led_control_register(uint8_t index, bool value) {
 }
 
 void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
+#ifdef I2C_ASYNC_ENABLE
+    if (g_pwm_buffer_async_failed[index]) {
+        g_pwm_buffer_async_failed[index]               = false;
+        g_pwm_buffer_update_required[index]            = true;
+        g_led_control_registers_update_required[index] = true;
+    }
+    if (g_pwm_buffer_update_required[index] && IS31FL3733_queue_pwm_update_fits(index)) {
+        // Unlock the command register, select PG1 and send all PWM registers in one transfer.
+        // The update stays pending unless all three writes were queued.
+        if (IS31FL3733_queue_register(addr, index, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5) && IS31FL3733_queue_register(addr, index, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM) && IS31FL3733_queue_write(addr, index, 0, g_pwm_buffer[index], 192)) {
+            g_pwm_buffer_update_required[index] = false;
+        }
+    }
+#else
     if (g_pwm_buffer_update_required[index]) {
         // Firstly we need to unlock the command register and select PG1.
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
@@ -233,6 +284,7 @@ void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
         }
         g_pwm_buffer_update_required[index] = false;
     }
+#endif
 }
 
 void IS31FL3733_update_led_control_registers(uint8_t addr, uint8_t index) {
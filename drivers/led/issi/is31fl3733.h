@@ -34,7 +34,7 @@ extern const is31_led PROGMEM g_is31_leds[DRIVER_LED_TOTAL];
 
 void IS31FL3733_init(uint8_t addr, uint8_t sync);
 bool IS31FL3733_write_register(uint8_t addr, uint8_t reg, uint8_t data);
-bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer);
+bool IS31FL3733_write_dirty_pwm_blocks(uint8_t addr, uint8_t index);
 
 void IS31FL3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void IS31FL3733_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
@@ -44,7 +44,7 @@ void IS31FL3733_set_led_control_register(uint8_t index, bool red, bool green, bo
 // This should not be called from an interrupt
 // (eg. from a timer interrupt).
 // Call this while idle (in between matrix scans).
-// If the buffer is dirty, it will update the driver with the buffer.
+// If the buffer is dirty, it will update the driver with the changed blocks of the buffer.
 void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index);
 void IS31FL3733_update_led_control_registers(uint8_t addr, uint8_t index);
 
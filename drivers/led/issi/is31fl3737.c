@@ -76,15 +76,70 @@ uint8_t g_twi_transfer_buffer[20];
 // The control buffers match the PG0 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in IS31FL3737_write_pwm_buffer() but it's
+// buffers and the transfers in IS31FL3737_write_dirty_pwm_blocks() but it's
 // probably not worth the extra complexity.
 
 uint8_t g_pwm_buffer[DRIVER_COUNT][192];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+
+// One bit per 16 byte block of the PWM buffers, set when a value in the block changed.
+// Everything starts dirty, so the first update writes the whole buffer.
+#define ISSI_PWM_BLOCK_SIZE 16
+#define ISSI_PWM_BLOCK_COUNT (192 / ISSI_PWM_BLOCK_SIZE)
+uint16_t g_pwm_buffer_dirty_blocks[DRIVER_COUNT] = {[0 ... DRIVER_COUNT - 1] = (1U << ISSI_PWM_BLOCK_COUNT) - 1};
 
 uint8_t g_led_control_registers[DRIVER_COUNT][24]             = {0};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
 
+#ifdef I2C_ASYNC_ENABLE
+// PWM updates are only queued on the I2C thread. A failed transfer is flagged
+// from its completion callback, and the next update then resends everything.
+static volatile bool g_pwm_buffer_async_failed[DRIVER_COUNT] = {false};
+
+static void IS31FL3737_async_complete(i2c_status_t status, void *arg) {
+    if (status != I2C_STATUS_SUCCESS) {
+        g_pwm_buffer_async_failed[(uintptr_t)arg] = true;
+    }
+}
+
+// A failing write is retried up to ISSI_PERSISTENCE times by the I2C thread
+static bool IS31FL3737_queue_write(uint8_t addr, uint8_t index, uint8_t reg, const uint8_t *data, uint16_t length) {
+    return i2c_writeReg_async(addr << 1, reg, data, length, ISSI_TIMEOUT, ISSI_PERSISTENCE, IS31FL3737_async_complete, (void *)(uintptr_t)index) == I2C_STATUS_SUCCESS;
+}
+
+static bool IS31FL3737_queue_register(uint8_t addr, uint8_t index, uint8_t reg, uint8_t data) {
+    return IS31FL3737_queue_write(addr, index, reg, &data, 1);
+}
+
+// One bit per driver that was skipped because the queue was full, those go first next time
+static uint8_t g_pwm_buffer_async_deferred = 0;
+
+// Whether unlock, page select and all dirty runs fit into the queue right now
+static bool IS31FL3737_queue_pwm_update_fits(uint8_t index) {
+    if (g_pwm_buffer_async_deferred && !(g_pwm_buffer_async_deferred & (1U << index))) {
+        return false;
+    }
+
+    uint8_t  transfers = 2;
+    uint16_t bytes     = 2 * 2;
+    for (uint8_t block = 0; block < ISSI_PWM_BLOCK_COUNT; block++) {
+        if (g_pwm_buffer_dirty_blocks[index] & (1U << block)) {
+            if (block == 0 || !(g_pwm_buffer_dirty_blocks[index] & (1U << (block - 1)))) {
+                transfers++;
+                bytes++;
+            }
+            bytes += ISSI_PWM_BLOCK_SIZE;
+        }
+    }
+
+    if (!i2c_async_can_queue(transfers, bytes)) {
+        g_pwm_buffer_async_deferred |= 1U << index;
+        return false;
+    }
+    g_pwm_buffer_async_deferred &= ~(1U << index);
+    return true;
+}
+#endif
+
 void IS31FL3737_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     g_twi_transfer_buffer[0] = reg;
     g_twi_transfer_buffer[1] = data;
@@ -98,30 +153,38 @@ void IS31FL3737_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void IS31FL3737_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+bool IS31FL3737_write_dirty_pwm_blocks(uint8_t addr, uint8_t index) {
     // assumes PG1 is already selected
-
-    // transmit PWM registers in 12 transfers of 16 bytes
-    // g_twi_transfer_buffer[] is 20 bytes
-
-    // iterate over the pwm_buffer contents at 16 byte intervals
-    for (int i = 0; i < 192; i += 16) {
-        g_twi_transfer_buffer[0] = i;
-        // copy the data from i to i+15
-        // device will auto-increment register for data after the first byte
-        // thus this sets registers 0x00-0x0F, 0x10-0x1F, etc. in one transfer
-        for (int j = 0; j < 16; j++) {
-            g_twi_transfer_buffer[1 + j] = pwm_buffer[i + j];
+    // runs of adjacent dirty blocks are sent as a single auto-increment transfer,
+    // blocks are only marked clean once they have been written
+    for (uint8_t first = 0; first < ISSI_PWM_BLOCK_COUNT; first++) {
+        if (!(g_pwm_buffer_dirty_blocks[index] & (1U << first))) {
+            continue;
+        }
+        uint8_t last = first;
+        while (last + 1 < ISSI_PWM_BLOCK_COUNT && (g_pwm_buffer_dirty_blocks[index] & (1U << (last + 1)))) {
+            last++;
         }
 
-#if ISSI_PERSISTENCE > 0
-        for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT) == 0) break;
+        uint8_t  reg     = first * ISSI_PWM_BLOCK_SIZE;
+        uint16_t length  = (last - first + 1) * ISSI_PWM_BLOCK_SIZE;
+        bool     written = false;
+#if defined(I2C_ASYNC_ENABLE)
+        written = IS31FL3737_queue_write(addr, index, reg, &g_pwm_buffer[index][reg], length);
+#elif ISSI_PERSISTENCE > 0
+        for (uint8_t i = 0; i < ISSI_PERSISTENCE && !written; i++) {
+            written = i2c_writeReg(addr << 1, reg, &g_pwm_buffer[index][reg], length, ISSI_TIMEOUT) == 0;
         }
 #else
-        i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, ISSI_TIMEOUT);
+        written = i2c_writeReg(addr << 1, reg, &g_pwm_buffer[index][reg], length, ISSI_TIMEOUT) == 0;
 #endif
+        if (!written) {
+            return false;
+        }
+        g_pwm_buffer_dirty_blocks[index] &= ~((1U << (last + 1)) - (1U << first));
+        first = last;
     }
+    return true;
 }
 
 void IS31FL3737_init(uint8_t addr) {
@@ -169,15 +232,21 @@ void IS31FL3737_init(uint8_t addr) {
     wait_ms(10);
 }
 
+static inline void IS31FL3737_set_pwm_register(uint8_t driver, uint8_t reg, uint8_t value) {
+    if (g_pwm_buffer[driver][reg] != value) {
+        g_pwm_buffer[driver][reg] = value;
+        g_pwm_buffer_dirty_blocks[driver] |= 1U << (reg / ISSI_PWM_BLOCK_SIZE);
+    }
+}
+
 void IS31FL3737_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     is31_led led;
     if (index >= 0 && index < DRIVER_LED_TOTAL) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        IS31FL3737_set_pwm_register(led.driver, led.r, red);
+        IS31FL3737_set_pwm_register(led.driver, led.g, green);
+        IS31FL3737_set_pwm_register(led.driver, led.b, blue);
     }
 }
 
@@ -218,14 +287,26 @@ void IS31FL3737_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void IS31FL3737_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+#ifdef I2C_ASYNC_ENABLE
+    if (g_pwm_buffer_async_failed[index]) {
+        g_pwm_buffer_async_failed[index] = false;
+        g_pwm_buffer_dirty_blocks[index] = (1U << ISSI_PWM_BLOCK_COUNT) - 1;
+    }
+#endif
+    if (g_pwm_buffer_dirty_blocks[index]) {
         // Firstly we need to unlock the command register and select PG1
+#ifdef I2C_ASYNC_ENABLE
+        if (!IS31FL3737_queue_pwm_update_fits(index) || !IS31FL3737_queue_register(addr, index, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5) || !IS31FL3737_queue_register(addr, index, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM)) {
+            return;
+        }
+#else
         IS31FL3737_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
         IS31FL3737_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM);
+#endif
 
-        IS31FL3737_write_pwm_buffer(addr, g_pwm_buffer[index]);
+        // Blocks that were not written stay dirty and are retried on the next update
+        IS31FL3737_write_dirty_pwm_blocks(addr, index);
     }
-    g_pwm_buffer_update_required[index] = false;
 }
 
 void IS31FL3737_update_led_control_registers(uint8_t addr, uint8_t index) {
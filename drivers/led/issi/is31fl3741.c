@@ -78,14 +78,84 @@ uint8_t g_twi_transfer_buffer[20] = {0xFF};
 // The scaling buffers match the PG2 and PG3 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in IS31FL3741_write_pwm_buffer() but it's
+// buffers and the transfers in IS31FL3741_write_dirty_pwm_blocks() but it's
 // probably not worth the extra complexity.
 uint8_t g_pwm_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT]        = {false};
 bool    g_scaling_registers_update_required[DRIVER_COUNT] = {false};
 
+// One bit per 18 byte block of the PWM buffers, set when a value in the block changed.
+// The first 180 registers are on PG0 and the rest on PG1, so no block spans both pages.
+// Everything starts dirty, so the first update writes the whole buffer.
+#define ISSI_PWM_BLOCK_SIZE 18
+#define ISSI_PWM_PAGE_SIZE 180
+#define ISSI_PWM_PAGE_BLOCKS (ISSI_PWM_PAGE_SIZE / ISSI_PWM_BLOCK_SIZE)
+#define ISSI_PWM_BLOCK_COUNT ((ISSI_MAX_LEDS + ISSI_PWM_BLOCK_SIZE - 1) / ISSI_PWM_BLOCK_SIZE)
+uint32_t g_pwm_buffer_dirty_blocks[DRIVER_COUNT] = {[0 ... DRIVER_COUNT - 1] = (1UL << ISSI_PWM_BLOCK_COUNT) - 1};
+
 uint8_t g_scaling_registers[DRIVER_COUNT][ISSI_MAX_LEDS];
 
+#ifdef I2C_ASYNC_ENABLE
+// PWM updates are only queued on the I2C thread. A failed transfer is flagged
+// from its completion callback, and the next update then resends everything.
+static volatile bool g_pwm_buffer_async_failed[DRIVER_COUNT] = {false};
+
+static void IS31FL3741_async_complete(i2c_status_t status, void *arg) {
+    if (status != I2C_STATUS_SUCCESS) {
+        g_pwm_buffer_async_failed[(uintptr_t)arg] = true;
+    }
+}
+
+// A failing write is retried up to ISSI_PERSISTENCE times by the I2C thread
+static bool IS31FL3741_queue_write(uint8_t addr, uint8_t index, uint8_t reg, const uint8_t *data, uint16_t length) {
+    return i2c_writeReg_async(addr << 1, reg, data, length, ISSI_TIMEOUT, ISSI_PERSISTENCE, IS31FL3741_async_complete, (void *)(uintptr_t)index) == I2C_STATUS_SUCCESS;
+}
+
+static bool IS31FL3741_queue_register(uint8_t addr, uint8_t index, uint8_t reg, uint8_t data) {
+    return IS31FL3741_queue_write(addr, index, reg, &data, 1);
+}
+
+// Drivers that were skipped for lack of queue space are updated before the rest
+static uint8_t g_pwm_buffer_async_deferred = 0;
+
+// Counts unlock and page select per dirty page, plus one transfer per run of dirty blocks
+static bool IS31FL3741_queue_pwm_update_fits(uint8_t index) {
+    if (g_pwm_buffer_async_deferred && !(g_pwm_buffer_async_deferred & (1U << index))) {
+        return false;
+    }
+
+    uint8_t  transfers = 0;
+    uint16_t bytes     = 0;
+    for (uint8_t page = 0; page < 2; page++) {
+        uint8_t  page_first = page * ISSI_PWM_PAGE_BLOCKS;
+        uint8_t  page_end   = page ? ISSI_PWM_BLOCK_COUNT : ISSI_PWM_PAGE_BLOCKS;
+        uint32_t page_mask  = (1UL << page_end) - (1UL << page_first);
+        if (!(g_pwm_buffer_dirty_blocks[index] & page_mask)) {
+            continue;
+        }
+
+        transfers += 2;
+        bytes += 2 * 2;
+        for (uint8_t block = page_first; block < page_end; block++) {
+            if (!(g_pwm_buffer_dirty_blocks[index] & (1UL << block))) {
+                continue;
+            }
+            if (block == page_first || !(g_pwm_buffer_dirty_blocks[index] & (1UL << (block - 1)))) {
+                transfers++;
+                bytes++;
+            }
+            bytes += ISSI_PWM_BLOCK_SIZE;
+        }
+    }
+
+    if (!i2c_async_can_queue(transfers, bytes)) {
+        g_pwm_buffer_async_deferred |= 1U << index;
+        return false;
+    }
+    g_pwm_buffer_async_deferred &= ~(1U << index);
+    return true;
+}
+#endif
+
 void IS31FL3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     g_twi_transfer_buffer[0] = reg;
     g_twi_transfer_buffer[1] = data;
@@ -99,50 +169,62 @@ void IS31FL3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-bool IS31FL3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
-    // unlock the command register and select PG2
-    IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
-    IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM0);
+bool IS31FL3741_write_dirty_pwm_blocks(uint8_t addr, uint8_t index) {
+    // runs of adjacent dirty blocks on the same page are sent as a single auto-increment
+    // transfer, blocks are only marked clean once they have been written
+    for (uint8_t page = 0; page < 2; page++) {
+        uint8_t  page_first = page * ISSI_PWM_PAGE_BLOCKS;
+        uint8_t  page_end   = page ? ISSI_PWM_BLOCK_COUNT : ISSI_PWM_PAGE_BLOCKS;
+        uint32_t page_mask  = (1UL << page_end) - (1UL << page_first);
+        if (!(g_pwm_buffer_dirty_blocks[index] & page_mask)) {
+            continue;
+        }
 
-    for (int i = 0; i < 342; i += 18) {
-        if (i == 180) {
-            // unlock the command register and select PG2
-            IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
-            IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM1);
+        // unlock the command register and select PG0 or PG1
+#ifdef I2C_ASYNC_ENABLE
+        if (!IS31FL3741_queue_register(addr, index, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5) || !IS31FL3741_queue_register(addr, index, ISSI_COMMANDREGISTER, page ? ISSI_PAGE_PWM1 : ISSI_PAGE_PWM0)) {
+            return false;
         }
+#else
+        IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
+        IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, page ? ISSI_PAGE_PWM1 : ISSI_PAGE_PWM0);
+#endif
 
-        g_twi_transfer_buffer[0] = i % 180;
-        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 18);
+        for (uint8_t first = page_first; first < page_end; first++) {
+            if (!(g_pwm_buffer_dirty_blocks[index] & (1UL << first))) {
+                continue;
+            }
+            uint8_t last = first;
+            while (last + 1 < page_end && (g_pwm_buffer_dirty_blocks[index] & (1UL << (last + 1)))) {
+                last++;
+            }
 
-#if ISSI_PERSISTENCE > 0
-        for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, ISSI_TIMEOUT) != 0) {
+            uint16_t offset = first * ISSI_PWM_BLOCK_SIZE;
+            uint16_t end    = (last + 1) * ISSI_PWM_BLOCK_SIZE;
+            uint8_t  reg    = offset - page * ISSI_PWM_PAGE_SIZE;
+            if (end > ISSI_MAX_LEDS) {
+                // the last block is only partially used, as the total number is 351
+                end = ISSI_MAX_LEDS;
+            }
+#if defined(I2C_ASYNC_ENABLE)
+            if (!IS31FL3741_queue_write(addr, index, reg, &g_pwm_buffer[index][offset], end - offset)) {
                 return false;
             }
-        }
+#elif ISSI_PERSISTENCE > 0
+            for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
+                if (i2c_writeReg(addr << 1, reg, &g_pwm_buffer[index][offset], end - offset, ISSI_TIMEOUT) != 0) {
+                    return false;
+                }
+            }
 #else
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, ISSI_TIMEOUT) != 0) {
-            return false;
-        }
+            if (i2c_writeReg(addr << 1, reg, &g_pwm_buffer[index][offset], end - offset, ISSI_TIMEOUT) != 0) {
+                return false;
+            }
 #endif
-    }
-
-    // transfer the left cause the total number is 351
-    g_twi_transfer_buffer[0] = 162;
-    memcpy(g_twi_transfer_buffer + 1, pwm_buffer + 342, 9);
-
-#if ISSI_PERSISTENCE > 0
-    for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, ISSI_TIMEOUT) != 0) {
-            return false;
+            g_pwm_buffer_dirty_blocks[index] &= ~((1UL << (last + 1)) - (1UL << first));
+            first = last;
         }
     }
-#else
-    if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, ISSI_TIMEOUT) != 0) {
-        return false;
-    }
-#endif
-
     return true;
 }
 
@@ -173,15 +255,21 @@ void IS31FL3741_init(uint8_t addr) {
     wait_ms(10);
 }
 
+static inline void IS31FL3741_set_pwm_register(uint8_t driver, uint16_t reg, uint8_t value) {
+    if (g_pwm_buffer[driver][reg] != value) {
+        g_pwm_buffer[driver][reg] = value;
+        g_pwm_buffer_dirty_blocks[driver] |= 1UL << (reg / ISSI_PWM_BLOCK_SIZE);
+    }
+}
+
 void IS31FL3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     is31_led led;
     if (index >= 0 && index < DRIVER_LED_TOTAL) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        IS31FL3741_set_pwm_register(led.driver, led.r, red);
+        IS31FL3741_set_pwm_register(led.driver, led.g, green);
+        IS31FL3741_set_pwm_register(led.driver, led.b, blue);
     }
 }
 
@@ -217,19 +305,27 @@ void IS31FL3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void IS31FL3741_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
-        IS31FL3741_write_pwm_buffer(addr, g_pwm_buffer[index]);
+#ifdef I2C_ASYNC_ENABLE
+    if (g_pwm_buffer_async_failed[index]) {
+        g_pwm_buffer_async_failed[index] = false;
+        g_pwm_buffer_dirty_blocks[index] = (1UL << ISSI_PWM_BLOCK_COUNT) - 1;
+    }
+#endif
+    if (g_pwm_buffer_dirty_blocks[index]) {
+#ifdef I2C_ASYNC_ENABLE
+        if (!IS31FL3741_queue_pwm_update_fits(index)) {
+            return;
+        }
+#endif
+        // Blocks that were not written stay dirty and are retried on the next update
+        IS31FL3741_write_dirty_pwm_blocks(addr, index);
     }
-
-    g_pwm_buffer_update_required[index] = false;
 }
 
 void IS31FL3741_set_pwm_buffer(const is31_led *pled, uint8_t red, uint8_t green, uint8_t blue) {
-    g_pwm_buffer[pled->driver][pled->r] = red;
-    g_pwm_buffer[pled->driver][pled->g] = green;
-    g_pwm_buffer[pled->driver][pled->b] = blue;
-
-    g_pwm_buffer_update_required[pled->driver] = true;
+    IS31FL3741_set_pwm_register(pled->driver, pled->r, red);
+    IS31FL3741_set_pwm_register(pled->driver, pled->g, green);
+    IS31FL3741_set_pwm_register(pled->driver, pled->b, blue);
 }
 
 void IS31FL3741_update_led_control_registers(uint8_t addr, uint8_t index) {
@@ -6,6 +6,11 @@
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
 
+// Asynchronous sends are only of use when there's a second pixdata buffer to fill in the meantime
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER && defined(PROTOCOL_CHIBIOS)
+#        define QP_COMMS_SPI_ASYNC
+#    endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
 
@@ -43,6 +48,22 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    ifdef QP_COMMS_SPI_ASYNC
+uint32_t qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    uint32_t       bytes_remaining = byte_count;
+    const uint8_t *p               = (const uint8_t *)data;
+    while (bytes_remaining > 0) {
+        // Each chunk waits for the previous one to finish, only the last one is still in flight on return
+        uint32_t bytes_this_loop = bytes_remaining < 1024 ? bytes_remaining : 1024;
+        spi_transmit_async(p, bytes_this_loop);
+        p += bytes_this_loop;
+        bytes_remaining -= bytes_this_loop;
+    }
+
+    return byte_count - bytes_remaining;
+}
+#    endif // QP_COMMS_SPI_ASYNC
+
 void qp_comms_spi_stop(painter_device_t device) {
     struct painter_driver_t *     driver       = (struct painter_driver_t *)device;
     struct qp_comms_spi_config_t *comms_config = (struct qp_comms_spi_config_t *)driver->comms_config;
@@ -55,6 +76,9 @@ const struct painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    ifdef QP_COMMS_SPI_ASYNC
+    .comms_send_async = qp_comms_spi_send_data_async,
+#    endif // QP_COMMS_SPI_ASYNC
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,9 +119,22 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        ifdef QP_COMMS_SPI_ASYNC
+uint32_t qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    struct painter_driver_t *              driver       = (struct painter_driver_t *)device;
+    struct qp_comms_spi_dc_reset_config_t *comms_config = (struct qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    writePinHigh(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+#        endif // QP_COMMS_SPI_ASYNC
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     struct painter_driver_t *              driver       = (struct painter_driver_t *)device;
     struct qp_comms_spi_dc_reset_config_t *comms_config = (struct qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+#        ifdef QP_COMMS_SPI_ASYNC
+    // Any pixel data still in flight needs D/C to stay high until it's done
+    spi_transmit_async_wait();
+#        endif // QP_COMMS_SPI_ASYNC
     writePinLow(comms_config->dc_pin);
     spi_write(cmd);
 }
@@ -125,6 +162,9 @@ const struct painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        ifdef QP_COMMS_SPI_ASYNC
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+#        endif // QP_COMMS_SPI_ASYNC
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
@@ -0,0 +1,367 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "color.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_surface.h"
+
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+
+#    include "qp_comms_dummy.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Common
+
+// Device definition
+typedef struct surface_painter_device_t {
+    struct painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    // Framebuffer, holding panel_width * panel_height pixels of native_bits_per_pixel each
+    uint8_t *buffer;
+
+    // Window set by the last viewport, and the position within it where the next pixel is written
+    uint16_t viewport_l;
+    uint16_t viewport_t;
+    uint16_t viewport_r;
+    uint16_t viewport_b;
+    uint16_t pixdata_x;
+    uint16_t pixdata_y;
+
+    // Union of all the regions written since the last flush
+    struct {
+        bool     is_dirty;
+        uint16_t l;
+        uint16_t t;
+        uint16_t r;
+        uint16_t b;
+    } dirty;
+
+    // Device the surface is transferred to on flush, and where
+    painter_device_t target;
+    uint16_t         target_x;
+    uint16_t         target_y;
+} surface_painter_device_t;
+
+// Driver storage
+surface_painter_device_t surface_drivers[SURFACE_NUM_DEVICES] = {0};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+static inline uint8_t surface_get_packed(const uint8_t *buffer, uint32_t pixel_pos, uint8_t bits_per_pixel) {
+    uint32_t bit_pos = pixel_pos * bits_per_pixel;
+    uint8_t  mask    = (uint8_t)((1u << bits_per_pixel) - 1);
+    return (buffer[bit_pos / 8] >> (bit_pos % 8)) & mask;
+}
+
+static inline void surface_set_packed(uint8_t *buffer, uint32_t pixel_pos, uint8_t bits_per_pixel, uint8_t value) {
+    uint32_t bit_pos = pixel_pos * bits_per_pixel;
+    uint8_t  mask    = (uint8_t)(((1u << bits_per_pixel) - 1) << (bit_pos % 8));
+    buffer[bit_pos / 8] = (buffer[bit_pos / 8] & ~mask) | ((value << (bit_pos % 8)) & mask);
+}
+
+static void surface_mark_dirty(surface_painter_device_t *surface, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    if (!surface->dirty.is_dirty) {
+        surface->dirty.is_dirty = true;
+        surface->dirty.l        = left;
+        surface->dirty.t        = top;
+        surface->dirty.r        = right;
+        surface->dirty.b        = bottom;
+    } else {
+        surface->dirty.l = QP_MIN(surface->dirty.l, left);
+        surface->dirty.t = QP_MIN(surface->dirty.t, top);
+        surface->dirty.r = QP_MAX(surface->dirty.r, right);
+        surface->dirty.b = QP_MAX(surface->dirty.b, bottom);
+    }
+}
+
+static void surface_reset(surface_painter_device_t *surface) {
+    memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(surface->base.panel_width, surface->base.panel_height, surface->base.native_bits_per_pixel));
+    surface->viewport_l = 0;
+    surface->viewport_t = 0;
+    surface->viewport_r = surface->base.panel_width - 1;
+    surface->viewport_b = surface->base.panel_height - 1;
+    surface->pixdata_x  = 0;
+    surface->pixdata_y  = 0;
+    surface_mark_dirty(surface, 0, 0, surface->base.panel_width - 1, surface->base.panel_height - 1);
+}
+
+// Transfers the dirty region of a 16bpp surface, which already matches the target's native format
+static bool surface_flush_rgb565(surface_painter_device_t *surface, struct painter_driver_t *target) {
+    if (target->native_bits_per_pixel != 16) {
+        qp_dprintf("surface_flush_rgb565: fail (target is not 16bpp)\n");
+        return false;
+    }
+
+    const uint16_t *buffer = (const uint16_t *)surface->buffer;
+    uint16_t        width  = surface->dirty.r - surface->dirty.l + 1;
+
+    // Full-width regions are contiguous in the framebuffer, so they can be sent in one go
+    if (width == surface->base.panel_width) {
+        uint32_t rows = surface->dirty.b - surface->dirty.t + 1;
+        return target->driver_vtable->pixdata((painter_device_t)target, &buffer[(uint32_t)surface->dirty.t * width], rows * width);
+    }
+
+    for (uint16_t y = surface->dirty.t; y <= surface->dirty.b; ++y) {
+        if (!target->driver_vtable->pixdata((painter_device_t)target, &buffer[(uint32_t)y * surface->base.panel_width + surface->dirty.l], width)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Transfers the dirty region of a grayscale surface, converting each level to the target's native format
+static bool surface_flush_grayscale(surface_painter_device_t *surface, struct painter_driver_t *target) {
+    const uint8_t  bits_per_pixel = surface->base.native_bits_per_pixel;
+    const uint16_t levels         = 1u << bits_per_pixel;
+    if (levels > sizeof(qp_internal_global_pixel_lookup_table) / sizeof(qp_internal_global_pixel_lookup_table[0])) {
+        qp_dprintf("surface_flush_grayscale: fail (surface bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE)\n", (int)bits_per_pixel);
+        return false;
+    }
+
+    // Build the lookup table for each of the grayscale levels -- this replaces any palette already generated
+    qp_internal_invalidate_palette();
+    for (uint16_t i = 0; i < levels; ++i) {
+        qp_internal_global_pixel_lookup_table[i].hsv888.h = 0;
+        qp_internal_global_pixel_lookup_table[i].hsv888.s = 0;
+        qp_internal_global_pixel_lookup_table[i].hsv888.v = (uint8_t)(i * 255 / (levels - 1));
+    }
+    if (!target->driver_vtable->palette_convert((painter_device_t)target, levels, qp_internal_global_pixel_lookup_table)) {
+        return false;
+    }
+
+    uint32_t max_pixels = qp_internal_num_pixels_in_buffer((painter_device_t)target);
+    uint32_t write_pos  = 0;
+    for (uint16_t y = surface->dirty.t; y <= surface->dirty.b; ++y) {
+        for (uint16_t x = surface->dirty.l; x <= surface->dirty.r; ++x) {
+            uint8_t level = surface_get_packed(surface->buffer, (uint32_t)y * surface->base.panel_width + x, bits_per_pixel);
+            if (!target->driver_vtable->append_pixels((painter_device_t)target, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, write_pos++, 1, &level)) {
+                return false;
+            }
+
+            // If we've hit the transmit limit, send out the entire buffer and reset the write position
+            if (write_pos == max_pixels) {
+                if (!qp_internal_send_pixdata_buffer((painter_device_t)target, write_pos)) {
+                    return false;
+                }
+                write_pos = 0;
+            }
+        }
+    }
+
+    // Send any remaining pixels
+    return write_pos == 0 || qp_internal_send_pixdata_buffer((painter_device_t)target, write_pos);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter API implementations
+
+// Initialization
+static bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+
+    // Rotation is handled by the target panel, the surface is always drawn upright
+    if (rotation != QP_ROTATION_0) {
+        qp_dprintf("qp_surface_init: fail (only QP_ROTATION_0 is supported)\n");
+        return false;
+    }
+
+    surface_reset(surface);
+    return true;
+}
+
+// Power control
+static bool qp_surface_power(painter_device_t device, bool power_on) {
+    // No-op, as there's no hardware for this device.
+    return true;
+}
+
+// Screen clear
+static bool qp_surface_clear(painter_device_t device) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    surface_reset(surface);
+    return true;
+}
+
+// Screen flush
+static bool qp_surface_flush(painter_device_t device) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    if (!surface->dirty.is_dirty) {
+        // Nothing has changed since the last flush.
+        return true;
+    }
+
+    if (!surface->target) {
+        qp_dprintf("qp_surface_flush: fail (no target device)\n");
+        return false;
+    }
+
+    struct painter_driver_t *target = (struct painter_driver_t *)surface->target;
+    if (!qp_comms_start(surface->target)) {
+        qp_dprintf("qp_surface_flush: fail (could not start comms on target)\n");
+        return false;
+    }
+
+    bool ret = target->driver_vtable->viewport(surface->target, surface->target_x + surface->dirty.l, surface->target_y + surface->dirty.t, surface->target_x + surface->dirty.r, surface->target_y + surface->dirty.b);
+    if (ret) {
+        ret = (surface->base.native_bits_per_pixel == 16) ? surface_flush_rgb565(surface, target) : surface_flush_grayscale(surface, target);
+    }
+    if (ret) {
+        ret = target->driver_vtable->flush(surface->target);
+    }
+    qp_comms_stop(surface->target);
+
+    if (ret) {
+        surface->dirty.is_dirty = false;
+    }
+    return ret;
+}
+
+// Viewport to draw to
+static bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    if (left > right || top > bottom || right >= surface->base.panel_width || bottom >= surface->base.panel_height) {
+        qp_dprintf("qp_surface_viewport: fail (viewport outside of surface)\n");
+        return false;
+    }
+
+    surface->viewport_l = left;
+    surface->viewport_t = top;
+    surface->viewport_r = right;
+    surface->viewport_b = bottom;
+    surface->pixdata_x  = left;
+    surface->pixdata_y  = top;
+    surface_mark_dirty(surface, left, top, right, bottom);
+    return true;
+}
+
+// Stream pixel data to the current write position in the framebuffer
+static bool qp_surface_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    surface_painter_device_t *surface        = (surface_painter_device_t *)device;
+    const uint8_t             bits_per_pixel = surface->base.native_bits_per_pixel;
+    const uint8_t *           src            = (const uint8_t *)pixel_data;
+    uint32_t                  src_pos        = 0;
+
+    while (native_pixel_count > 0) {
+        // Wrap back to the start of the window once it has been filled, same as a panel's GRAM
+        if (surface->pixdata_y > surface->viewport_b) {
+            surface->pixdata_y = surface->viewport_t;
+        }
+
+        uint32_t dst_pos = (uint32_t)surface->pixdata_y * surface->base.panel_width + surface->pixdata_x;
+        uint32_t run     = QP_MIN((uint32_t)(surface->viewport_r - surface->pixdata_x + 1), native_pixel_count);
+        if (bits_per_pixel >= 8) {
+            uint8_t bytes_per_pixel = bits_per_pixel / 8;
+            memcpy(&surface->buffer[dst_pos * bytes_per_pixel], &src[src_pos * bytes_per_pixel], run * bytes_per_pixel);
+        } else {
+            for (uint32_t i = 0; i < run; ++i) {
+                surface_set_packed(surface->buffer, dst_pos + i, bits_per_pixel, surface_get_packed(src, src_pos + i, bits_per_pixel));
+            }
+        }
+
+        src_pos += run;
+        native_pixel_count -= run;
+        surface->pixdata_x += run;
+        if (surface->pixdata_x > surface->viewport_r) {
+            surface->pixdata_x = surface->viewport_l;
+            surface->pixdata_y++;
+        }
+    }
+
+    return true;
+}
+
+// Convert supplied palette entries into their native equivalents
+static bool qp_surface_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    struct painter_driver_t *driver = (struct painter_driver_t *)device;
+    if (driver->native_bits_per_pixel == 16) {
+        for (int16_t i = 0; i < palette_size; ++i) {
+            RGB      rgb      = hsv_to_rgb_nocie((HSV){palette[i].hsv888.h, palette[i].hsv888.s, palette[i].hsv888.v});
+            uint16_t rgb565   = (((uint16_t)rgb.r) >> 3) << 11 | (((uint16_t)rgb.g) >> 2) << 5 | (((uint16_t)rgb.b) >> 3);
+            palette[i].rgb565 = (rgb565 >> 8) | (rgb565 << 8);
+        }
+    } else {
+        for (int16_t i = 0; i < palette_size; ++i) {
+            palette[i].mono = palette[i].hsv888.v >> (8 - driver->native_bits_per_pixel);
+        }
+
+        // Grayscale levels aren't valid for any other device, so don't let the palette be reused by the next draw
+        qp_internal_invalidate_palette();
+    }
+    return true;
+}
+
+// Append pixels to the target location, keyed by the pixel index
+static bool qp_surface_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    struct painter_driver_t *driver = (struct painter_driver_t *)device;
+    if (driver->native_bits_per_pixel == 16) {
+        uint16_t *buf = (uint16_t *)target_buffer;
+        for (uint32_t i = 0; i < pixel_count; ++i) {
+            buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+        }
+    } else {
+        for (uint32_t i = 0; i < pixel_count; ++i) {
+            surface_set_packed(target_buffer, pixel_offset + i, driver->native_bits_per_pixel, palette[palette_indices[i]].mono);
+        }
+    }
+    return true;
+}
+
+const struct painter_driver_vtable_t surface_driver_vtable = {
+    .init            = qp_surface_init,
+    .power           = qp_surface_power,
+    .clear           = qp_surface_clear,
+    .flush           = qp_surface_flush,
+    .viewport        = qp_surface_viewport,
+    .pixdata         = qp_surface_pixdata,
+    .palette_convert = qp_surface_palette_convert,
+    .append_pixels   = qp_surface_append_pixels,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Factory functions
+
+// Factory function for creating a handle to a surface
+painter_device_t qp_make_surface(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, void *buffer) {
+    if (bits_per_pixel != 1 && bits_per_pixel != 2 && bits_per_pixel != 4 && bits_per_pixel != 8 && bits_per_pixel != 16) {
+        qp_dprintf("qp_make_surface: fail (unsupported bpp (%d))\n", (int)bits_per_pixel);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < SURFACE_NUM_DEVICES; ++i) {
+        surface_painter_device_t *driver = &surface_drivers[i];
+        if (!driver->base.driver_vtable) {
+            driver->base.driver_vtable         = &surface_driver_vtable;
+            driver->base.comms_vtable          = &dummy_comms_vtable;
+            driver->base.panel_width           = panel_width;
+            driver->base.panel_height          = panel_height;
+            driver->base.rotation              = QP_ROTATION_0;
+            driver->base.offset_x              = 0;
+            driver->base.offset_y              = 0;
+            driver->base.native_bits_per_pixel = bits_per_pixel;
+
+            // Framebuffer and flush target
+            driver->base.comms_config = NULL;
+            driver->buffer            = (uint8_t *)buffer;
+            driver->target            = NULL;
+            driver->target_x          = 0;
+            driver->target_y          = 0;
+            return (painter_device_t)driver;
+        }
+    }
+    return NULL;
+}
+
+void qp_surface_set_target(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y) {
+    surface_painter_device_t *driver = (surface_painter_device_t *)surface;
+    driver->target                   = target;
+    driver->target_x                 = x;
+    driver->target_y                 = y;
+
+    // Nothing of the surface is on the new target yet
+    surface_mark_dirty(driver, 0, 0, driver->base.panel_width - 1, driver->base.panel_height - 1);
+}
+
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
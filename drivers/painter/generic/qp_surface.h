@@ -0,0 +1,54 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "qp_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter surface configurables (add to your keyboard's config.h)
+
+#ifndef SURFACE_NUM_DEVICES
+/**
+ * @def This controls the maximum number of surface devices that Quantum Painter can use at any one time.
+ *      Increasing this number allows for multiple surfaces to be used.
+ */
+#    define SURFACE_NUM_DEVICES 1
+#endif
+
+/**
+ * @def The number of bytes of RAM required for the framebuffer of a surface with the supplied geometry.
+ */
+#define SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, height, bits_per_pixel) ((((uint32_t)(width)) * (height) * (bits_per_pixel) + 7) / 8)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter surface device factories
+
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+/**
+ * Factory method for an off-screen surface, rendering into a framebuffer in RAM.
+ *
+ * @note 16bpp surfaces use the byte-swapped RGB565 pixel format of the TFT panels. Lower bit depths hold grayscale
+ *       levels, with each byte packing its pixels starting from the least significant bits.
+ *
+ * @param panel_width[in] the width of the surface
+ * @param panel_height[in] the height of the surface
+ * @param bits_per_pixel[in] the pixel depth of the surface -- one of 1, 2, 4, 8, or 16
+ * @param buffer[in] the framebuffer, at least SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, bits_per_pixel) bytes long
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_make_surface(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, void *buffer);
+
+/**
+ * Sets the device a surface is transferred to when \ref qp_flush is invoked on the surface. Only the region changed
+ * since the previous flush is transferred, after which \ref qp_flush is also invoked on the target.
+ *
+ * @note The target needs to have been initialized with \ref qp_init beforehand. 16bpp surfaces require a 16bpp target.
+ *
+ * @param surface[in] the handle of the surface
+ * @param target[in] the handle of the device to transfer to, or NULL to detach the surface
+ * @param x[in] the x-position on the target where the surface's top-left corner is drawn
+ * @param y[in] the y-position on the target where the surface's top-left corner is drawn
+ */
+void qp_surface_set_target(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y);
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -103,9 +103,9 @@ bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top,
     return true;
 }
 
-// Stream pixel data to the current write position in GRAM
+// Stream pixel data to the current write position in GRAM -- the data is left untouched until the next comms call, so it can be sent asynchronously
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
-    qp_comms_send(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+    qp_comms_send_async(device, pixel_data, native_pixel_count * sizeof(uint16_t));
     return true;
 }
 
@@ -27,3 +27,10 @@ void soft_serial_initiator_init(void);
 void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
+
+#ifdef SPLIT_TRANSPORT_NOTIFY
+// target pushes the target2initiator buffer of a transaction, outside of any transaction
+bool soft_serial_target_notify(int sstd_index);
+// initiator receives pushed buffers; returns true if any arrived since the last call
+bool soft_serial_initiator_receive_notifications(void);
+#endif
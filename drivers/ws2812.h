@@ -68,3 +68,14 @@
  *         - Wait 50us to reset the LEDs
  */
 void ws2812_setleds(LED_TYPE *ledarray, uint16_t number_of_leds);
+
+#if defined(WS2812_DRIVER_GPIO_DMA)
+/* The gpio_dma driver sends the frame in the background: ws2812_setleds()
+ * returns as soon as the transfer is started.
+ *
+ * ws2812_busy() returns whether a frame is still being sent, and ws2812_wait()
+ * blocks until it is done.
+ */
+bool ws2812_busy(void);
+void ws2812_wait(void);
+#endif
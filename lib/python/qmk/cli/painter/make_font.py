@@ -33,6 +33,7 @@ def painter_make_font_image(cli):
 @cli.argument('-u', '--unicode-glyphs', default='', help='Also generate the specified unicode glyphs.')
 @cli.argument('-f', '--format', required=True, help='Output format, valid types: %s' % (', '.join(valid_formats.keys())))
 @cli.argument('-r', '--no-rle', arg_only=True, action='store_true', help='Disable the use of RLE to minimise converted image size.')
+@cli.argument('-z', '--lz', arg_only=True, action='store_true', help='Enable the use of LZ to minimise converted image size (requires QUANTUM_PAINTER_SUPPORTS_LZ).')
 @cli.subcommand('Converts an input font image to something QMK firmware understands')
 def painter_convert_font_image(cli):
     # Work out the format
@@ -52,7 +53,7 @@ def painter_convert_font_image(cli):
 
     # Render out the data
     out_data = BytesIO()
-    font.save_to_qff(format, (False if cli.args.no_rle else True), out_data)
+    font.save_to_qff(format, (False if cli.args.no_rle else True), cli.args.lz, out_data)
 
     # Work out the text substitutions for rendering the output data
     subs = {
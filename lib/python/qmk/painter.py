@@ -266,3 +266,80 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    # Back references can reach this many bytes into the previously-decoded output, see quantum_painter_lz.md
+    window_size = 256
+    min_match = 3
+    max_match = 130
+    max_literals = 128
+
+    data = bytes(bytearray)
+    output = []
+    literals = []
+    positions = {}  # positions of each 3-byte sequence seen so far
+
+    def append_literals():
+        while len(literals) > 0:
+            chunk = literals[:max_literals]
+            output.append(len(chunk) - 1)
+            output.extend(chunk)
+            del literals[:max_literals]
+
+    def remember(pos):
+        if pos + min_match <= len(data):
+            positions.setdefault(data[pos:pos + min_match], []).append(pos)
+
+    def longest_match(pos):
+        best = (0, 0)
+        if pos + min_match > len(data):
+            return best
+        limit = min(max_match, len(data) - pos)
+        for candidate in reversed(positions.get(data[pos:pos + min_match], [])):
+            distance = pos - candidate
+            if distance > window_size:
+                break
+            length = min_match
+            while length < limit and data[candidate + length] == data[pos + length]:
+                length += 1
+            if length > best[0]:
+                best = (length, distance)
+                if length == limit:
+                    break
+        return best
+
+    pos = 0
+    while pos < len(data):
+        (length, distance) = longest_match(pos)
+        remember(pos)
+
+        # If starting the match one byte later gives a longer one, emit this byte as a literal instead
+        if length >= min_match and longest_match(pos + 1)[0] > length:
+            length = 0
+
+        if length >= min_match:
+            append_literals()
+            output.append(128 + length - min_match)
+            output.append(distance - 1)
+            for n in range(pos + 1, pos + length):
+                remember(n)
+            pos += length
+        else:
+            literals.append(data[pos])
+            pos += 1
+
+    append_literals()
+    return output
+
+
+def compress_bytes_smallest(bytearray, use_rle=True, use_lz=False):
+    """Returns the smallest of the enabled encodings of the supplied bytes, as a tuple of the compression scheme byte
+    (see qp_internal_formats.h, painter_compression_t) and the encoded bytes. Ties favour the simplest encoding.
+    """
+    candidates = [(0x00, list(bytearray))]
+    if use_rle:
+        candidates.append((0x01, compress_bytes_qmk_rle(bytearray)))
+    if use_lz:
+        candidates.append((0x02, compress_bytes_qmk_lz(bytearray)))
+    return min(candidates, key=lambda c: len(c[1]))
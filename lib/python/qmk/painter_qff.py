@@ -185,24 +185,29 @@ class QFFFont:
         self.glyph_height = 0
         return
 
-    def _extract_glyphs(self, format):
-        total_data_size = 0
-        total_rle_data_size = 0
+    def _extract_glyphs(self, format, use_rle: bool, use_lz: bool):
+        # Each glyph is encoded separately, with every requested compression scheme (see qp_internal_formats.h, painter_compression_t)
+        encoders = {0x00: list}
+        if use_rle:
+            encoders[0x01] = qmk.painter.compress_bytes_qmk_rle
+        if use_lz:
+            encoders[0x02] = qmk.painter.compress_bytes_qmk_lz
+        total_data_sizes = {compression: 0 for compression in encoders}
 
         converted_img = qmk.painter.convert_requested_format(self.image, format)
         (self.palette, _) = qmk.painter.convert_image_bytes(converted_img, format)
 
-        # Work out how many bytes used for RLE vs. non-RLE
+        # Work out how many bytes are used by each compression scheme
         for _, glyph_entry in self.glyph_data.items():
             glyph_img = converted_img.crop((glyph_entry.x, 1, glyph_entry.x + glyph_entry.w, 1 + self.glyph_height))
             (_, this_glyph_image_bytes) = qmk.painter.convert_image_bytes(glyph_img, format)
-            this_glyph_rle_bytes = qmk.painter.compress_bytes_qmk_rle(this_glyph_image_bytes)
-            total_data_size += len(this_glyph_image_bytes)
-            total_rle_data_size += len(this_glyph_rle_bytes)
-            glyph_entry['image_uncompressed_bytes'] = this_glyph_image_bytes
-            glyph_entry['image_compressed_bytes'] = this_glyph_rle_bytes
+            image_bytes = {}
+            for compression, encoder in encoders.items():
+                image_bytes[compression] = encoder(this_glyph_image_bytes)
+                total_data_sizes[compression] += len(image_bytes[compression])
+            glyph_entry['image_bytes'] = image_bytes
 
-        return (total_data_size, total_rle_data_size)
+        return total_data_sizes
 
     def _parse_image(self, img, include_ascii_glyphs: bool = True, unicode_glyphs: str = ''):
         # Clear out any existing font metadata
@@ -325,23 +330,21 @@ class QFFFont:
         self._parse_image(Image.open(str(img_file)), include_ascii_glyphs, unicode_glyphs)
         return
 
-    def save_to_qff(self, format: Dict[str, Any], use_rle: bool, fp):
+    def save_to_qff(self, format: Dict[str, Any], use_rle: bool, use_lz: bool, fp):
         # Drop out if there's no image loaded
         if self.image is None:
             self.logger.error('No image is loaded.')
             return
 
-        # Work out if we want to use RLE at all, skipping it if it's not any smaller (it's applied per-glyph)
-        (total_data_size, total_rle_data_size) = self._extract_glyphs(format)
-        if use_rle:
-            use_rle = (total_rle_data_size < total_data_size)
+        # Work out which compression scheme gives the smallest font, preferring the simplest on ties (it's applied per-glyph)
+        total_data_sizes = self._extract_glyphs(format, use_rle, use_lz)
+        compression = min(total_data_sizes, key=lambda c: (total_data_sizes[c], c))
 
-        # For each glyph, work out which image data we want to use and append it to the image buffer, recording the byte-wise offset
+        # For each glyph, append its image data to the image buffer, recording the byte-wise offset
         img_buffer = bytes()
         for _, glyph_entry in self.glyph_data.items():
             glyph_entry['data_offset'] = len(img_buffer)
-            glyph_img_bytes = glyph_entry.image_compressed_bytes if use_rle else glyph_entry.image_uncompressed_bytes
-            img_buffer += bytes(glyph_img_bytes)
+            img_buffer += bytes(glyph_entry.image_bytes[compression])
 
         font_descriptor = QFFFontDescriptor()
         ascii_table = QFFAsciiGlyphTableV1()
@@ -365,7 +368,7 @@ class QFFFont:
         font_descriptor.unicode_glyph_count = len(unicode_table.glyphs.keys())
         font_descriptor.is_transparent = False
         font_descriptor.format = format['image_format_byte']
-        font_descriptor.compression = 0x01 if use_rle else 0x00
+        font_descriptor.compression = compression
 
         # Write a dummy font descriptor -- we'll have to come back and write it properly once we've rendered out everything else
         font_descriptor_location = fp.tell()
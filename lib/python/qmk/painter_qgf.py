@@ -230,6 +230,7 @@ def _save(im, fp, filename):
     verbose = encoderinfo.get("verbose", False)
     use_deltas = encoderinfo.get("use_deltas", True)
     use_rle = encoderinfo.get("use_rle", True)
+    use_lz = encoderinfo.get("use_lz", False)
 
     # Helper for inline verbose prints
     def vprint(s):
@@ -290,12 +291,8 @@ def _save(im, fp, filename):
         converted = qmk.painter.convert_requested_format(this_frame, format)
         graphic_data = qmk.painter.convert_image_bytes(converted, format)
 
-        # Convert the raw data to RLE-encoded if requested
-        raw_data = graphic_data[1]
-        if use_rle:
-            rle_data = qmk.painter.compress_bytes_qmk_rle(graphic_data[1])
-        use_raw_this_frame = not use_rle or len(raw_data) <= len(rle_data)
-        image_data = raw_data if use_raw_this_frame else rle_data
+        # Encode the raw data with whichever of the requested compression schemes is smallest
+        (compression, image_data) = qmk.painter.compress_bytes_smallest(graphic_data[1], use_rle, use_lz)
 
         # Work out if a delta frame is smaller than injecting it directly
         use_delta_this_frame = False
@@ -318,11 +315,7 @@ def _save(im, fp, filename):
                 delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format)
 
                 # Work out how large the delta frame is going to be with compression etc.
-                delta_raw_data = delta_graphic_data[1]
-                if use_rle:
-                    delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-                delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-                delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
+                (delta_compression, delta_image_data) = qmk.painter.compress_bytes_smallest(delta_graphic_data[1], use_rle, use_lz)
 
                 # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
                 # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
@@ -334,9 +327,7 @@ def _save(im, fp, filename):
                     size = delta_size
                     converted = delta_converted
                     graphic_data = delta_graphic_data
-                    raw_data = delta_raw_data
-                    rle_data = delta_rle_data
-                    use_raw_this_frame = delta_use_raw_this_frame
+                    compression = delta_compression
                     image_data = delta_image_data
                     use_delta_this_frame = True
 
@@ -347,7 +338,7 @@ def _save(im, fp, filename):
         frame_descriptor.is_delta = use_delta_this_frame
         frame_descriptor.is_transparent = False
         frame_descriptor.format = format['image_format_byte']
-        frame_descriptor.compression = 0x00 if use_raw_this_frame else 0x01  # See qp.h, painter_compression_t
+        frame_descriptor.compression = compression  # See qp_internal_formats.h, painter_compression_t
         frame_descriptor.delay = frame.info['duration'] if 'duration' in frame.info else 1000  # If we're not an animation, just pretend we're delaying for 1000ms
         frame_descriptor.write(fp)
 
@@ -119,6 +119,176 @@ static i2c_status_t chibios_to_qmk(const msg_t* status) {
     }
 }
 
+#ifdef I2C_ASYNC_ENABLE
+#    ifndef I2C_ASYNC_QUEUE_SIZE
+#        define I2C_ASYNC_QUEUE_SIZE 16
+#    endif
+#    ifndef I2C_ASYNC_BUFFER_SIZE
+#        define I2C_ASYNC_BUFFER_SIZE 512
+#    endif
+
+typedef struct {
+    uint8_t              address;
+    uint16_t             length;
+    uint16_t             timeout;
+    uint8_t              attempts;
+    const uint8_t*       data;
+    i2c_async_callback_t callback;
+    void*                callback_arg;
+} i2c_async_transfer_t;
+
+static i2c_async_transfer_t i2c_async_queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t              i2c_async_head    = 0; // only written by the submitting thread
+static uint8_t              i2c_async_tail    = 0; // only written by the I2C thread
+static bool                 i2c_async_started = false;
+static semaphore_t          i2c_async_free_slots;
+static semaphore_t          i2c_async_pending;
+static thread_reference_t   i2c_async_waiter = NULL;
+// Copies of the queued packets (register address included), filled from the start
+// again whenever the queue ran empty
+static uint8_t  i2c_async_buffer[I2C_ASYNC_BUFFER_SIZE];
+static uint16_t i2c_async_buffer_used = 0; // only written by the submitting thread
+
+static THD_WORKING_AREA(waI2CAsyncThread, 256);
+static THD_FUNCTION(I2CAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+
+    // Device whose transfer failed; the rest of its queued transfers are dropped, as they may depend on it
+    uint8_t failed_address = 0;
+    bool    failed         = false;
+
+    while (true) {
+        chSemWait(&i2c_async_pending);
+
+        i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_tail];
+
+        i2c_status_t status = I2C_STATUS_ERROR;
+        if (!failed || transfer->address != failed_address) {
+            // Only resent while it fails, up to the requested number of attempts
+            uint8_t attempt = 0;
+            do {
+                i2cStart(&I2C_DRIVER, &i2cconfig);
+                msg_t result = i2cMasterTransmitTimeout(&I2C_DRIVER, (transfer->address >> 1), transfer->data, transfer->length, 0, 0, TIME_MS2I(transfer->timeout));
+                status       = chibios_to_qmk(&result);
+            } while (status != I2C_STATUS_SUCCESS && ++attempt < transfer->attempts);
+
+            if (status != I2C_STATUS_SUCCESS && !failed) {
+                failed         = true;
+                failed_address = transfer->address;
+            }
+        }
+        if (transfer->callback) {
+            transfer->callback(status, transfer->callback_arg);
+        }
+
+        i2c_async_tail = (i2c_async_tail + 1) % I2C_ASYNC_QUEUE_SIZE;
+        chSysLock();
+        if (chSemGetCounterI(&i2c_async_pending) == 0) {
+            failed = false;
+        }
+        chSemSignalI(&i2c_async_free_slots);
+        chThdResumeI(&i2c_async_waiter, MSG_OK);
+        chSchRescheduleS();
+        chSysUnlock();
+    }
+}
+
+static i2c_status_t i2c_async_submit(uint8_t address, bool has_regaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout, uint8_t attempts, i2c_async_callback_t callback, void* arg) {
+    uint16_t packet_length = length + (has_regaddr ? 1 : 0);
+    if (packet_length > I2C_ASYNC_BUFFER_SIZE) {
+        return I2C_STATUS_ERROR;
+    }
+
+    if (!i2c_async_started) {
+        i2c_async_started = true;
+        chSemObjectInit(&i2c_async_free_slots, I2C_ASYNC_QUEUE_SIZE);
+        chSemObjectInit(&i2c_async_pending, 0);
+        chThdCreateStatic(waI2CAsyncThread, sizeof(waI2CAsyncThread), NORMALPRIO + 1, I2CAsyncThread, NULL);
+    }
+
+    // The buffer is only reused once every queued packet has been sent
+    if (i2c_async_buffer_used + packet_length > I2C_ASYNC_BUFFER_SIZE) {
+        i2c_async_wait();
+    }
+    if (!i2c_async_busy()) {
+        i2c_async_buffer_used = 0;
+    }
+
+    // Blocks while the queue is full
+    chSemWait(&i2c_async_free_slots);
+
+    uint8_t* packet = &i2c_async_buffer[i2c_async_buffer_used];
+    if (has_regaddr) {
+        packet[0] = regaddr;
+    }
+    memcpy(&packet[packet_length - length], data, length);
+    i2c_async_buffer_used += packet_length;
+
+    i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_head];
+    transfer->address              = address;
+    transfer->length               = packet_length;
+    transfer->timeout              = timeout;
+    transfer->attempts             = attempts;
+    transfer->data                 = packet;
+    transfer->callback             = callback;
+    transfer->callback_arg         = arg;
+
+    i2c_async_head = (i2c_async_head + 1) % I2C_ASYNC_QUEUE_SIZE;
+    chSemSignal(&i2c_async_pending);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout, uint8_t attempts, i2c_async_callback_t callback, void* arg) {
+    return i2c_async_submit(address, false, 0, data, length, timeout, attempts, callback, arg);
+}
+
+i2c_status_t i2c_writeReg_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout, uint8_t attempts, i2c_async_callback_t callback, void* arg) {
+    return i2c_async_submit(devaddr, true, regaddr, data, length, timeout, attempts, callback, arg);
+}
+
+bool i2c_async_can_queue(uint8_t transfers, uint16_t bytes) {
+    if (!i2c_async_started) {
+        return true;
+    }
+
+    chSysLock();
+    cnt_t free_slots = chSemGetCounterI(&i2c_async_free_slots);
+    chSysUnlock();
+
+    // Nothing to wait for on an empty queue, oversized batches block in i2c_async_submit() as before
+    if (free_slots == I2C_ASYNC_QUEUE_SIZE) {
+        return true;
+    }
+    return free_slots >= transfers && i2c_async_buffer_used + bytes <= I2C_ASYNC_BUFFER_SIZE;
+}
+
+bool i2c_async_busy(void) {
+    if (!i2c_async_started) {
+        return false;
+    }
+
+    chSysLock();
+    bool busy = chSemGetCounterI(&i2c_async_free_slots) < I2C_ASYNC_QUEUE_SIZE;
+    chSysUnlock();
+    return busy;
+}
+
+void i2c_async_wait(void) {
+    if (!i2c_async_started) {
+        return;
+    }
+
+    chSysLock();
+    while (chSemGetCounterI(&i2c_async_free_slots) < I2C_ASYNC_QUEUE_SIZE) {
+        chThdSuspendS(&i2c_async_waiter);
+    }
+    chSysUnlock();
+}
+#else
+#    define i2c_async_wait()
+#endif // I2C_ASYNC_ENABLE
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -140,12 +310,14 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_start(uint8_t address) {
+    i2c_async_wait();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     return I2C_STATUS_SUCCESS;
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
@@ -153,6 +325,7 @@ i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length,
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
@@ -160,6 +333,7 @@ i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16
 }
 
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
@@ -174,6 +348,7 @@ i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data,
 }
 
 i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
@@ -189,6 +364,7 @@ i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* da
 }
 
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
@@ -196,6 +372,7 @@ i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16
 }
 
 i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
@@ -204,5 +381,6 @@ i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uin
 }
 
 void i2c_stop(void) {
+    i2c_async_wait();
     i2cStop(&I2C_DRIVER);
 }
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 typedef int16_t i2c_status_t;
 
@@ -41,3 +42,21 @@ i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* da
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 void         i2c_stop(void);
+
+#ifdef I2C_ASYNC_ENABLE
+/* Queued transmits, executed in order by a separate thread. The payload is copied
+ * into an I2C_ASYNC_BUFFER_SIZE byte buffer, so the caller may reuse it right away.
+ * The calling thread only blocks when the queue or that buffer is full, which
+ * i2c_async_can_queue() checks up front (bytes include the register addresses).
+ * A failing transfer is retried up to attempts times in total; once it has failed,
+ * the remaining queued transfers to that device are dropped and fail as well.
+ * The callback (optional) runs on the I2C thread and must not call any i2c_* function.
+ * The blocking functions above wait for all queued transfers before they start. */
+typedef void (*i2c_async_callback_t)(i2c_status_t status, void* arg);
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout, uint8_t attempts, i2c_async_callback_t callback, void* arg);
+i2c_status_t i2c_writeReg_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout, uint8_t attempts, i2c_async_callback_t callback, void* arg);
+bool         i2c_async_can_queue(uint8_t transfers, uint16_t bytes);
+bool         i2c_async_busy(void);
+void         i2c_async_wait(void);
+#endif
@@ -32,6 +32,13 @@ static SerialConfig serial_config = {
 };
 #endif
 
+#if defined(SPLIT_TRANSPORT_NOTIFY)
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error "SPLIT_TRANSPORT_NOTIFY requires SERIAL_USART_FULL_DUPLEX"
+#    endif
+_Static_assert(NOTIFY_MAGIC > ((NUM_TOTAL_TRANSACTIONS - 1) | HANDSHAKE_MAGIC), "NOTIFY_MAGIC collides with a handshake");
+#endif
+
 static SerialDriver* serial_driver = &SERIAL_USART_DRIVER;
 
 static inline bool react_to_transactions(void);
@@ -39,6 +46,13 @@ static inline bool __attribute__((nonnull)) receive(uint8_t* destination, const
 static inline bool __attribute__((nonnull)) send(const uint8_t* source, const size_t size);
 static inline bool initiate_transaction(uint8_t sstd_index);
 static inline void usart_clear(void);
+#if defined(SPLIT_TRANSPORT_NOTIFY)
+static inline bool receive_notification(void);
+static inline void receive_pending_notifications(void);
+
+/* Set whenever a pushed buffer was received, cleared once reported. */
+static bool notification_received = false;
+#endif
 
 /**
  * @brief Clear the receive input queue.
@@ -254,17 +268,92 @@ void soft_serial_initiator_init(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#if defined(SPLIT_TRANSPORT_NOTIFY)
+    split_shared_memory_lock();
+    /* Buffers pushed by the slave are waiting in the receive queue,
+     * anything else in it is dropped. */
+    receive_pending_notifications();
+#else
     /* Clear the receive queue, to start with a clean slate.
      * Parts of failed transactions or spurious bytes could still be in it. */
     usart_clear();
 
     split_shared_memory_lock();
+#endif
     bool result = initiate_transaction((uint8_t)index);
     split_shared_memory_unlock();
 
     return result;
 }
 
+#if defined(SPLIT_TRANSPORT_NOTIFY)
+/**
+ * @brief Receive the remainder of a buffer pushed by the slave, after its NOTIFY_MAGIC.
+ *
+ * @return bool Indicates success of the receive.
+ */
+static inline bool receive_notification(void) {
+    uint8_t sstd_index;
+    if (!receive(&sstd_index, sizeof(sstd_index)) || sstd_index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t* trans = &split_transaction_table[sstd_index];
+    if (!receive(split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size)) {
+        return false;
+    }
+
+    notification_received = true;
+    return true;
+}
+
+/**
+ * @brief Receive all buffers pushed by the slave that are waiting in the receive queue,
+ * without blocking when there are none.
+ */
+static inline void receive_pending_notifications(void) {
+    msg_t byte;
+    while ((byte = sdGetTimeout(serial_driver, TIME_IMMEDIATE)) != MSG_TIMEOUT) {
+        if (byte == NOTIFY_MAGIC && !receive_notification()) {
+            dprintln("USART: Notification failed.");
+        }
+    }
+}
+
+/**
+ * @brief Receive buffers pushed by the slave half.
+ *
+ * @return bool Indicates whether any buffer arrived since the last call.
+ */
+bool soft_serial_initiator_receive_notifications(void) {
+    split_shared_memory_lock();
+    receive_pending_notifications();
+    bool received         = notification_received;
+    notification_received = false;
+    split_shared_memory_unlock();
+
+    return received;
+}
+
+/**
+ * @brief Push the target2initiator buffer of a transaction to the master half,
+ * outside of any transaction. The shared memory must be locked by the caller,
+ * which keeps the push from interleaving with a transaction.
+ *
+ * @param sstd_index Transaction Table index of the buffer to push.
+ * @return bool Indicates success of the push.
+ */
+bool soft_serial_target_notify(int sstd_index) {
+    if (sstd_index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t* trans     = &split_transaction_table[sstd_index];
+    uint8_t                   header[2] = {NOTIFY_MAGIC, (uint8_t)sstd_index};
+    return send(header, sizeof(header)) && send(split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+}
+#endif
+
 /**
  * @brief Initiate transaction to slave half.
  */
@@ -289,7 +378,22 @@ static inline bool initiate_transaction(uint8_t sstd_index) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
-    if (!receive(&sstd_index_shake, sizeof(sstd_index_shake)) || (sstd_index_shake != (sstd_index ^ HANDSHAKE_MAGIC))) {
+    if (!receive(&sstd_index_shake, sizeof(sstd_index_shake))) {
+        dprintln("USART: Handshake failed.");
+        return false;
+    }
+
+#if defined(SPLIT_TRANSPORT_NOTIFY)
+    /* The slave may have pushed a buffer before it saw the transaction. */
+    while (sstd_index_shake == NOTIFY_MAGIC) {
+        if (!receive_notification() || !receive(&sstd_index_shake, sizeof(sstd_index_shake))) {
+            dprintln("USART: Handshake failed.");
+            return false;
+        }
+    }
+#endif
+
+    if (sstd_index_shake != (sstd_index ^ HANDSHAKE_MAGIC)) {
         dprintln("USART: Handshake failed.");
         return false;
     }
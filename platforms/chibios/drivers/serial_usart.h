@@ -114,3 +114,6 @@
 #endif
 
 #define HANDSHAKE_MAGIC 7
+
+/* Starts a buffer pushed by the slave. Must never match a handshake. */
+#define NOTIFY_MAGIC 0xA5
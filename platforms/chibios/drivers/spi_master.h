@@ -85,6 +85,13 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/* Starts transmitting using DMA and returns immediately. The data must be left
+ * untouched until spi_transmit_async_wait() returns; every other spi_* call
+ * waits for the transfer to finish first. */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+void spi_transmit_async_wait(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
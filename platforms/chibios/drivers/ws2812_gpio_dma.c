@@ -0,0 +1,288 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+#include "ws2812.h"
+#include <ch.h>
+#include <hal.h>
+#include <string.h>
+
+/*
+ * WS2812 output on any GPIO pin, driven by a timer and three DMA streams
+ * writing the pin's BSRR register. Every timer period sends one bit:
+ *
+ * - the update event sets the pin high,
+ * - the compare event of channel 1, at T0H, clears the pin if the bit is a zero,
+ * - the compare event of channel 2, at T1H, clears the pin.
+ *
+ * Only the channel 1 stream reads the frame buffer, one halfword per bit, so
+ * ws2812_setleds() encodes the colors and returns while the frame is sent.
+ */
+
+#if defined(USE_GPIOV1)
+#    error "The gpio_dma WS2812 driver needs halfword GPIO access, use the pwm or spi driver on this MCU"
+#endif
+
+#ifndef WS2812_GPIO_DMA_TIMER
+#    define WS2812_GPIO_DMA_TIMER PWMD1 // TIMx
+#endif
+#ifndef WS2812_GPIO_DMA_FREQUENCY
+#    define WS2812_GPIO_DMA_FREQUENCY 8000000 // Must divide the clock of the timer
+#endif
+
+// DMA streams and channels of TIMx_UP, TIMx_CH1 and TIMx_CH2. The stream must
+// be able to write to the GPIO port, i.e. DMA2 on STM32F2/F4/F7.
+#if STM32_DMA_ADVANCED
+#    ifndef WS2812_GPIO_DMA_UP_STREAM
+#        define WS2812_GPIO_DMA_UP_STREAM STM32_DMA2_STREAM5
+#    endif
+#    ifndef WS2812_GPIO_DMA_UP_CHANNEL
+#        define WS2812_GPIO_DMA_UP_CHANNEL 6
+#    endif
+#    ifndef WS2812_GPIO_DMA_CH1_STREAM
+#        define WS2812_GPIO_DMA_CH1_STREAM STM32_DMA2_STREAM1
+#    endif
+#    ifndef WS2812_GPIO_DMA_CH1_CHANNEL
+#        define WS2812_GPIO_DMA_CH1_CHANNEL 6
+#    endif
+#    ifndef WS2812_GPIO_DMA_CH2_STREAM
+#        define WS2812_GPIO_DMA_CH2_STREAM STM32_DMA2_STREAM2
+#    endif
+#    ifndef WS2812_GPIO_DMA_CH2_CHANNEL
+#        define WS2812_GPIO_DMA_CH2_CHANNEL 6
+#    endif
+#else
+#    ifndef WS2812_GPIO_DMA_UP_STREAM
+#        define WS2812_GPIO_DMA_UP_STREAM STM32_DMA1_STREAM5
+#    endif
+#    ifndef WS2812_GPIO_DMA_CH1_STREAM
+#        define WS2812_GPIO_DMA_CH1_STREAM STM32_DMA1_STREAM2
+#    endif
+#    ifndef WS2812_GPIO_DMA_CH2_STREAM
+#        define WS2812_GPIO_DMA_CH2_STREAM STM32_DMA1_STREAM3
+#    endif
+#    define WS2812_GPIO_DMA_UP_CHANNEL 0
+#    define WS2812_GPIO_DMA_CH1_CHANNEL 0
+#    define WS2812_GPIO_DMA_CH2_CHANNEL 0
+#endif
+#if (STM32_DMA_SUPPORTS_DMAMUX == TRUE) && (!defined(WS2812_GPIO_DMA_UP_DMAMUX_ID) || !defined(WS2812_GPIO_DMA_CH1_DMAMUX_ID) || !defined(WS2812_GPIO_DMA_CH2_DMAMUX_ID))
+#    error "please consult your MCU's datasheet and specify in your config.h: #define WS2812_GPIO_DMA_UP_DMAMUX_ID STM32_DMAMUX1_TIM?_UP, WS2812_GPIO_DMA_CH1_DMAMUX_ID STM32_DMAMUX1_TIM?_CH1 and WS2812_GPIO_DMA_CH2_DMAMUX_ID STM32_DMAMUX1_TIM?_CH2"
+#endif
+
+// Push Pull or Open Drain Configuration
+// Default Push Pull
+#ifndef WS2812_EXTERNAL_PULLUP
+#    define WS2812_OUTPUT_MODE PAL_MODE_OUTPUT_PUSHPULL | PAL_STM32_OSPEED_HIGHEST
+#else
+#    define WS2812_OUTPUT_MODE PAL_MODE_OUTPUT_OPENDRAIN | PAL_STM32_OSPEED_HIGHEST
+#endif
+
+#ifdef RGBW
+#    define WS2812_CHANNELS 4
+#else
+#    define WS2812_CHANNELS 3
+#endif
+
+#define WS2812_NS_TO_TICKS(ns) (((ns) * (WS2812_GPIO_DMA_FREQUENCY / 1000000) + 500) / 1000)
+#define WS2812_PERIOD_TICKS WS2812_NS_TO_TICKS(WS2812_TIMING)
+#define WS2812_T0H_TICKS WS2812_NS_TO_TICKS(WS2812_T0H)
+#define WS2812_T1H_TICKS WS2812_NS_TO_TICKS(WS2812_T1H)
+
+#if WS2812_T0H_TICKS < 1 || WS2812_T1H_TICKS <= WS2812_T0H_TICKS || WS2812_PERIOD_TICKS <= WS2812_T1H_TICKS
+#    error "WS2812_GPIO_DMA_FREQUENCY is too low for the WS2812 bit timings"
+#endif
+
+/*
+ * The timer starts counting from zero, so its first update event is at the
+ * end of the first period. That period is left empty: its compare events
+ * consume the first buffer entry, which is a no-op, and the data bits start
+ * with the first update event.
+ */
+#define WS2812_BIT_N (1 + RGBLED_NUM * WS2812_CHANNELS * 8)
+
+#define WS2812_PIN_MASK (1U << PAL_PAD(RGB_DI_PIN))
+
+static uint16_t       ws2812_frame_buffer[WS2812_BIT_N];
+static LED_TYPE       ws2812_colors[RGBLED_NUM]; // Colors in the frame buffer
+static uint16_t       ws2812_led_count = 0;      // LEDs in the frame buffer
+static const uint32_t ws2812_set_word   = WS2812_PIN_MASK;
+static const uint32_t ws2812_clear_word = WS2812_PIN_MASK << 16;
+
+static volatile bool ws2812_sending = false;
+static systime_t     ws2812_frame_end;
+static thread_t *    ws2812_waiting_thread = NULL;
+
+static inline stm32_tim_t *ws2812_tim(void) {
+    return WS2812_GPIO_DMA_TIMER.tim;
+}
+
+// Called once the last clearing write of the frame has been made.
+static void ws2812_dma_complete(void *param, uint32_t flags) {
+    (void)param;
+
+    if (flags & (STM32_DMA_ISR_TCIF | STM32_DMA_ISR_TEIF)) {
+        ws2812_tim()->CR1 &= ~STM32_TIM_CR1_CEN;
+        dmaStreamDisable(WS2812_GPIO_DMA_UP_STREAM);
+        dmaStreamDisable(WS2812_GPIO_DMA_CH1_STREAM);
+        dmaStreamDisable(WS2812_GPIO_DMA_CH2_STREAM);
+
+        chSysLockFromISR();
+        ws2812_frame_end = chVTGetSystemTimeX();
+        ws2812_sending   = false;
+        if (ws2812_waiting_thread) {
+            chThdResumeI(&ws2812_waiting_thread, MSG_OK);
+        }
+        chSysUnlockFromISR();
+    }
+}
+
+static void ws2812_setup_stream(const stm32_dma_stream_t *stream, volatile void *peripheral, const void *memory, size_t count, uint32_t mode) {
+    dmaStreamSetPeripheral(stream, peripheral);
+    dmaStreamSetMemory0(stream, memory);
+    dmaStreamSetTransactionSize(stream, count);
+    dmaStreamSetMode(stream, mode | STM32_DMA_CR_DIR_M2P | STM32_DMA_CR_PL(3));
+}
+
+void ws2812_init(void) {
+    palSetLineMode(RGB_DI_PIN, WS2812_OUTPUT_MODE);
+    palClearLine(RGB_DI_PIN);
+
+    // The first entry is the empty period, all LEDs start off
+    ws2812_frame_buffer[0] = 0;
+    for (uint16_t i = 1; i < WS2812_BIT_N; i++) {
+        ws2812_frame_buffer[i] = WS2812_PIN_MASK;
+    }
+
+    dmaStreamAlloc(WS2812_GPIO_DMA_UP_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_GPIO_DMA_CH1_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamAlloc(WS2812_GPIO_DMA_CH2_STREAM - STM32_DMA_STREAM(0), 10, ws2812_dma_complete, NULL);
+#if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
+    dmaSetRequestSource(WS2812_GPIO_DMA_UP_STREAM, WS2812_GPIO_DMA_UP_DMAMUX_ID);
+    dmaSetRequestSource(WS2812_GPIO_DMA_CH1_STREAM, WS2812_GPIO_DMA_CH1_DMAMUX_ID);
+    dmaSetRequestSource(WS2812_GPIO_DMA_CH2_STREAM, WS2812_GPIO_DMA_CH2_DMAMUX_ID);
+#endif
+
+    // The channels only generate DMA requests, the pin is not a timer output
+    static const PWMConfig ws2812_pwm_config = {
+        .frequency = WS2812_GPIO_DMA_FREQUENCY,
+        .period    = WS2812_PERIOD_TICKS,
+        .callback  = NULL,
+        .channels =
+            {
+                [0 ... 3] = {.mode = PWM_OUTPUT_DISABLED, .callback = NULL},
+            },
+        .cr2  = 0,
+        .dier = TIM_DIER_UDE | TIM_DIER_CC1DE | TIM_DIER_CC2DE,
+    };
+    pwmStart(&WS2812_GPIO_DMA_TIMER, &ws2812_pwm_config);
+    pwmEnableChannel(&WS2812_GPIO_DMA_TIMER, 0, WS2812_T0H_TICKS);
+    pwmEnableChannel(&WS2812_GPIO_DMA_TIMER, 1, WS2812_T1H_TICKS);
+    ws2812_tim()->CR1 &= ~STM32_TIM_CR1_CEN;
+
+    ws2812_frame_end = chVTGetSystemTimeX();
+}
+
+bool ws2812_busy(void) {
+    return ws2812_sending;
+}
+
+void ws2812_wait(void) {
+    chSysLock();
+    if (ws2812_sending) {
+        chThdSuspendS(&ws2812_waiting_thread);
+    }
+    chSysUnlock();
+}
+
+static inline void ws2812_encode_byte(uint16_t *bits, uint8_t byte) {
+    // WS2812 protocol wants most significant bits first
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        bits[bit] = (byte & (0x80 >> bit)) ? 0 : WS2812_PIN_MASK;
+    }
+}
+
+// Setleds for standard RGB
+void ws2812_setleds(LED_TYPE *ledarray, uint16_t leds) {
+    static bool s_init = false;
+    if (!s_init) {
+        ws2812_init();
+        s_init = true;
+    }
+
+    // The previous frame is still read from the buffer
+    ws2812_wait();
+
+    if (leds > RGBLED_NUM) {
+        leds = RGBLED_NUM;
+    }
+
+    // Only LEDs whose color changed are encoded again, and an unchanged frame is not sent at all
+    bool changed = leds != ws2812_led_count;
+    for (uint16_t i = 0; i < leds; i++) {
+        if (memcmp(&ledarray[i], &ws2812_colors[i], sizeof(LED_TYPE)) == 0) {
+            continue;
+        }
+        ws2812_colors[i] = ledarray[i];
+        changed          = true;
+
+        uint16_t *bits = &ws2812_frame_buffer[1 + i * WS2812_CHANNELS * 8];
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+        ws2812_encode_byte(bits, ledarray[i].g);
+        ws2812_encode_byte(bits + 8, ledarray[i].r);
+        ws2812_encode_byte(bits + 16, ledarray[i].b);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+        ws2812_encode_byte(bits, ledarray[i].r);
+        ws2812_encode_byte(bits + 8, ledarray[i].g);
+        ws2812_encode_byte(bits + 16, ledarray[i].b);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+        ws2812_encode_byte(bits, ledarray[i].b);
+        ws2812_encode_byte(bits + 8, ledarray[i].g);
+        ws2812_encode_byte(bits + 16, ledarray[i].r);
+#endif
+#ifdef RGBW
+        ws2812_encode_byte(bits + 24, ledarray[i].w);
+#endif
+    }
+    ws2812_led_count = leds;
+    if (!changed) {
+        return;
+    }
+    size_t bit_count = leds * WS2812_CHANNELS * 8;
+
+    // The data line has to stay low for the reset time between frames
+    sysinterval_t since_end = chVTTimeElapsedSinceX(ws2812_frame_end);
+    if (since_end < TIME_US2I(WS2812_TRST_US)) {
+        chThdSleep(TIME_US2I(WS2812_TRST_US) - since_end);
+    }
+
+    stm32_gpio_t *port = PAL_PORT(RGB_DI_PIN);
+    // The update stream stops after the last bit, so the pin is not set again
+    // if the timer runs on until the completion interrupt stops it.
+    ws2812_setup_stream(WS2812_GPIO_DMA_UP_STREAM, &port->BSRR, &ws2812_set_word, bit_count, STM32_DMA_CR_CHSEL(WS2812_GPIO_DMA_UP_CHANNEL) | STM32_DMA_CR_PSIZE_WORD | STM32_DMA_CR_MSIZE_WORD);
+    ws2812_setup_stream(WS2812_GPIO_DMA_CH1_STREAM, (volatile uint8_t *)&port->BSRR + 2, ws2812_frame_buffer, bit_count + 1, STM32_DMA_CR_CHSEL(WS2812_GPIO_DMA_CH1_CHANNEL) | STM32_DMA_CR_PSIZE_HWORD | STM32_DMA_CR_MSIZE_HWORD | STM32_DMA_CR_MINC);
+    ws2812_setup_stream(WS2812_GPIO_DMA_CH2_STREAM, &port->BSRR, &ws2812_clear_word, bit_count + 1, STM32_DMA_CR_CHSEL(WS2812_GPIO_DMA_CH2_CHANNEL) | STM32_DMA_CR_PSIZE_WORD | STM32_DMA_CR_MSIZE_WORD | STM32_DMA_CR_TCIE | STM32_DMA_CR_TEIE);
+
+    ws2812_sending = true;
+    dmaStreamEnable(WS2812_GPIO_DMA_UP_STREAM);
+    dmaStreamEnable(WS2812_GPIO_DMA_CH1_STREAM);
+    dmaStreamEnable(WS2812_GPIO_DMA_CH2_STREAM);
+
+    // Drop any request left over from the previous frame, then start from an empty period
+    stm32_tim_t *tim = ws2812_tim();
+    tim->CNT         = 0;
+    tim->SR          = 0;
+    tim->CR1 |= STM32_TIM_CR1_CEN;
+}
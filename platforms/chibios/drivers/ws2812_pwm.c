@@ -1,6 +1,7 @@
 #include "ws2812.h"
 #include "quantum.h"
 #include <hal.h>
+#include <string.h>
 
 /* Adapted from https://github.com/joewa/WS2812-LED-Driver_ChibiOS/ */
 
@@ -248,6 +249,7 @@
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
 
 static uint32_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+static LED_TYPE ws2812_colors[RGBLED_NUM];              /**< Colors in the frame buffer, all off after init */
 
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
@@ -335,7 +337,16 @@ void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+    if (leds > RGBLED_NUM) {
+        leds = RGBLED_NUM;
+    }
+
+    // The DMA sends the frame buffer continuously, only LEDs whose color changed need to be encoded again
     for (uint16_t i = 0; i < leds; i++) {
+        if (memcmp(&ledarray[i], &ws2812_colors[i], sizeof(LED_TYPE)) == 0) {
+            continue;
+        }
+        ws2812_colors[i] = ledarray[i];
 #ifdef RGBW
         ws2812_write_led_rgbw(i, ledarray[i].r, ledarray[i].g, ledarray[i].b, ledarray[i].w);
 #else
@@ -1,5 +1,6 @@
 #include "quantum.h"
 #include "ws2812.h"
+#include <string.h>
 
 /* Adapted from https://github.com/gamazeps/ws2812b-chibios-SPIDMA/ */
 
@@ -80,7 +81,22 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#    define WS2812_SPI_BUFFER_COUNT 1
+#else
+// The next frame is encoded while the previous one is sent
+#    define WS2812_SPI_BUFFER_COUNT 2
+#endif
+
+static uint8_t txbuf[WS2812_SPI_BUFFER_COUNT][PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+
+// Colors encoded in each buffer, so unchanged LEDs are not encoded again
+static LED_TYPE txbuf_colors[WS2812_SPI_BUFFER_COUNT][RGBLED_NUM];
+
+#if WS2812_SPI_BUFFER_COUNT == 2
+static uint8_t       txbuf_front  = 0;     // Buffer being sent, or sent last
+static volatile bool txbuf_queued = false; // The other buffer is sent when the current transfer ends
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -100,8 +116,8 @@ static uint8_t get_protocol_eq(uint8_t data, int pos) {
     return eq;
 }
 
-static void set_led_color_rgb(LED_TYPE color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* buffer, LED_TYPE color, int pos) {
+    uint8_t* tx_start = &buffer[PREAMBLE_SIZE];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
     for (int j = 0; j < 4; j++)
@@ -131,9 +147,45 @@ static void set_led_color_rgb(LED_TYPE color, int pos) {
 #endif
 }
 
+static bool same_color(const LED_TYPE* a, const LED_TYPE* b) {
+    return memcmp(a, b, sizeof(LED_TYPE)) == 0;
+}
+
+// Encode the LEDs whose color differs from the one already in the buffer.
+static void update_buffer(uint8_t index, LED_TYPE* ledarray, uint16_t leds) {
+    for (uint16_t i = 0; i < leds; i++) {
+        if (!same_color(&ledarray[i], &txbuf_colors[index][i])) {
+            set_led_color_rgb(txbuf[index], ledarray[i], i);
+            txbuf_colors[index][i] = ledarray[i];
+        }
+    }
+}
+
+#if WS2812_SPI_BUFFER_COUNT == 2
+static void ws2812_spi_end(SPIDriver* spip) {
+    chSysLockFromISR();
+    if (txbuf_queued) {
+        txbuf_queued = false;
+        txbuf_front ^= 1;
+        spiStartSendI(spip, sizeof(txbuf[0]), txbuf[txbuf_front]);
+    }
+    chSysUnlockFromISR();
+}
+#    define WS2812_SPI_END_CB ws2812_spi_end
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
+
 void ws2812_init(void) {
     palSetLineMode(RGB_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
+    // Start with every LED off, matching the zeroed colors
+    for (uint8_t b = 0; b < WS2812_SPI_BUFFER_COUNT; b++) {
+        for (uint16_t i = 0; i < RGBLED_NUM; i++) {
+            set_led_color_rgb(txbuf[b], txbuf_colors[b][i], i);
+        }
+    }
+
 #ifdef WS2812_SPI_SCK_PIN
     palSetLineMode(WS2812_SPI_SCK_PIN, WS2812_SCK_OUTPUT_MODE);
 #endif // WS2812_SPI_SCK_PIN
@@ -145,7 +197,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(RGB_DI_PIN),
         PAL_PAD(RGB_DI_PIN),
         WS2812_SPI_DIVISOR_CR1_BR_X,
@@ -158,7 +210,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(RGB_DI_PIN),
         PAL_PAD(RGB_DI_PIN),
@@ -171,28 +223,64 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI, sizeof(txbuf) / sizeof(txbuf[0]), txbuf);
+    spiStartSend(&WS2812_SPI, sizeof(txbuf[0]), txbuf[0]);
 #endif
 }
 
 void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
     static bool s_init = false;
+    // Whatever the LEDs show before the first frame is unknown, so it is always sent
+    bool force = !s_init;
     if (!s_init) {
         ws2812_init();
         s_init = true;
     }
 
-    for (uint8_t i = 0; i < leds; i++) {
-        set_led_color_rgb(ledarray[i], i);
+    if (leds > RGBLED_NUM) {
+        leds = RGBLED_NUM;
+    }
+
+#if WS2812_SPI_BUFFER_COUNT == 1
+    bool changed = force;
+    for (uint16_t i = 0; i < leds && !changed; i++) {
+        changed = !same_color(&ledarray[i], &txbuf_colors[0][i]);
+    }
+    if (!changed) {
+        return;
     }
+    update_buffer(0, ledarray, leds);
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI, sizeof(txbuf) / sizeof(txbuf[0]), txbuf);
-#    else
-    spiStartSend(&WS2812_SPI, sizeof(txbuf) / sizeof(txbuf[0]), txbuf);
+    spiSend(&WS2812_SPI, sizeof(txbuf[0]), txbuf[0]);
 #    endif
+    // In circular buffer mode, the buffer is sent continuously
+#else
+    // A frame still waiting for the current transfer is replaced by this one
+    chSysLock();
+    bool queued  = txbuf_queued;
+    txbuf_queued = false;
+    chSysUnlock();
+
+    // Nothing is queued any more, so the front buffer does not change under us
+    uint8_t back    = txbuf_front ^ 1;
+    bool    changed = force || queued;
+    for (uint16_t i = 0; i < leds && !changed; i++) {
+        changed = !same_color(&ledarray[i], &txbuf_colors[txbuf_front][i]);
+    }
+    if (!changed) {
+        return;
+    }
+    update_buffer(back, ledarray, leds);
+
+    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms. If the previous frame is still being sent, this one
+    // follows as soon as it is done.
+    chSysLock();
+    if (WS2812_SPI.state == SPI_READY) {
+        txbuf_front = back;
+        spiStartSendI(&WS2812_SPI, sizeof(txbuf[0]), txbuf[back]);
+    } else {
+        txbuf_queued = true;
+    }
+    chSysUnlock();
 #endif
 }
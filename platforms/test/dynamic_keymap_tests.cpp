@@ -0,0 +1,248 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+extern "C" {
+#include "keymap.h"
+#include "eeprom.h"
+#include "dynamic_keymap.h"
+
+void advance_time(uint32_t ms);
+}
+
+/* Mock external EEPROM:
+ *
+ * Every eeprom_read_block()/eeprom_write_block() call stands for one bus
+ * transaction of an I2C/SPI EEPROM driver. The byte/word helpers and
+ * eeprom_update_block() come from drivers/eeprom/eeprom_driver.c, exactly
+ * as they do for the real external drivers, so the counters below show how
+ * many transactions each dynamic keymap operation costs.
+ */
+
+#define KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#define PAGE_COUNT(bytes) (((bytes) + EXTERNAL_EEPROM_PAGE_SIZE - 1) / EXTERNAL_EEPROM_PAGE_SIZE)
+
+static uint8_t  eeprom_contents[EEPROM_SIZE];
+static uint32_t bus_reads;
+static uint32_t bus_writes;
+
+extern "C" void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    bus_reads++;
+    memcpy(buf, &eeprom_contents[(uintptr_t)addr], len);
+}
+
+extern "C" void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    uintptr_t offset = (uintptr_t)addr;
+    bus_writes++;
+    EXPECT_EQ(offset / EXTERNAL_EEPROM_PAGE_SIZE, (offset + len - 1) / EXTERNAL_EEPROM_PAGE_SIZE) << "Write crosses an EEPROM page boundary";
+    memcpy(&eeprom_contents[offset], buf, len);
+}
+
+extern "C" void send_string(const char *str) {}
+
+// clang-format off
+#define ROW(base) { (base) + 0, (base) + 1, (base) + 2, (base) + 3, (base) + 4, (base) + 5, (base) + 6, (base) + 7, \
+                    (base) + 8, (base) + 9, (base) + 10, (base) + 11, (base) + 12, (base) + 13, (base) + 14, (base) + 15 }
+#define LAYER(base) { ROW((base) + 0x000), ROW((base) + 0x010), ROW((base) + 0x020), ROW((base) + 0x030), ROW((base) + 0x040), ROW((base) + 0x050) }
+extern "C" const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    LAYER(0x0100),
+    LAYER(0x0200),
+    LAYER(0x0300),
+    LAYER(0x0400),
+};
+// clang-format on
+
+class DynamicKeymapTest : public testing::Test {
+   protected:
+    void SetUp() override {
+        memset(eeprom_contents, 0xFF, sizeof(eeprom_contents));
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+        dynamic_keymap_cache_load();
+#endif
+        bus_reads  = 0;
+        bus_writes = 0;
+    }
+
+    void flush(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+        advance_time(1000);
+        dynamic_keymap_task();
+#endif
+    }
+};
+
+TEST_F(DynamicKeymapTest, ResetWritesWholePages) {
+    dynamic_keymap_reset();
+    EXPECT_EQ(bus_writes, PAGE_COUNT(KEYMAP_EEPROM_SIZE));
+
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint16_t expected = keymaps[layer][row][col];
+                uint8_t *address  = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, col);
+                ASSERT_EQ(dynamic_keymap_get_keycode(layer, row, col), expected);
+                ASSERT_EQ(eeprom_contents[(uintptr_t)address], expected >> 8);
+                ASSERT_EQ(eeprom_contents[(uintptr_t)address + 1], expected & 0xFF);
+            }
+        }
+    }
+}
+
+TEST_F(DynamicKeymapTest, ResetOfUnchangedKeymapDoesNotWrite) {
+    dynamic_keymap_reset();
+    bus_reads  = 0;
+    bus_writes = 0;
+
+    dynamic_keymap_reset();
+    EXPECT_EQ(bus_writes, 0);
+}
+
+TEST_F(DynamicKeymapTest, FullKeymapUpload) {
+    /* VIA uploads keymaps 28 bytes per raw HID packet */
+    uint8_t data[KEYMAP_EEPROM_SIZE];
+    for (uint16_t i = 0; i < sizeof(data); i++) {
+        data[i] = i * 7;
+    }
+    for (uint16_t offset = 0; offset < sizeof(data); offset += 28) {
+        dynamic_keymap_set_buffer(offset, MIN(28, sizeof(data) - offset), &data[offset]);
+    }
+    flush();
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    EXPECT_EQ(bus_writes, PAGE_COUNT(KEYMAP_EEPROM_SIZE));
+#else
+    EXPECT_LE(bus_writes, 2 * PAGE_COUNT(KEYMAP_EEPROM_SIZE));
+#endif
+    EXPECT_EQ(memcmp(&eeprom_contents[DYNAMIC_KEYMAP_EEPROM_ADDR], data, sizeof(data)), 0);
+
+    uint8_t readback[KEYMAP_EEPROM_SIZE];
+    bus_reads  = 0;
+    bus_writes = 0;
+    for (uint16_t offset = 0; offset < sizeof(readback); offset += 28) {
+        dynamic_keymap_get_buffer(offset, MIN(28, sizeof(readback) - offset), &readback[offset]);
+    }
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    EXPECT_EQ(bus_reads, 0);
+#else
+    EXPECT_EQ(bus_reads, (sizeof(readback) + 27) / 28);
+#endif
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+}
+
+TEST_F(DynamicKeymapTest, BufferAccessPastTheEndIsClamped) {
+    uint8_t data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    dynamic_keymap_set_buffer(KEYMAP_EEPROM_SIZE - 4, sizeof(data), data);
+    flush();
+    EXPECT_EQ(memcmp(&eeprom_contents[DYNAMIC_KEYMAP_EEPROM_ADDR + KEYMAP_EEPROM_SIZE - 4], data, 4), 0);
+    EXPECT_EQ(eeprom_contents[DYNAMIC_KEYMAP_EEPROM_ADDR + KEYMAP_EEPROM_SIZE], 0xFF);
+
+    uint8_t readback[8];
+    dynamic_keymap_get_buffer(KEYMAP_EEPROM_SIZE - 4, sizeof(readback), readback);
+    EXPECT_EQ(memcmp(readback, data, 4), 0);
+    for (uint8_t i = 4; i < sizeof(readback); i++) {
+        EXPECT_EQ(readback[i], 0);
+    }
+
+    memset(readback, 0xAA, sizeof(readback));
+    dynamic_keymap_get_buffer(KEYMAP_EEPROM_SIZE + 10, sizeof(readback), readback);
+    for (uint8_t i = 0; i < sizeof(readback); i++) {
+        EXPECT_EQ(readback[i], 0);
+    }
+}
+
+TEST_F(DynamicKeymapTest, KeycodeLookupsAndWrites) {
+    dynamic_keymap_reset();
+    dynamic_keymap_set_keycode(2, 3, 4, 0x1234);
+    flush();
+    bus_reads  = 0;
+    bus_writes = 0;
+
+    for (uint8_t i = 0; i < 100; i++) {
+        EXPECT_EQ(keymap_key_to_keycode(2, (keypos_t){.col = 4, .row = 3}), 0x1234);
+    }
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    EXPECT_EQ(bus_reads, 0);
+#endif
+    EXPECT_EQ(bus_writes, 0);
+}
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+TEST_F(DynamicKeymapTest, CachedWritesWaitForTheFlushDelay) {
+    dynamic_keymap_set_keycode(1, 2, 3, 0x4321);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), 0x4321);
+
+    advance_time(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY - 1);
+    dynamic_keymap_task();
+    EXPECT_EQ(bus_writes, 0);
+
+    // Another write restarts the delay
+    dynamic_keymap_set_keycode(1, 2, 4, 0x5678);
+    advance_time(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY - 1);
+    dynamic_keymap_task();
+    EXPECT_EQ(bus_writes, 0);
+
+    advance_time(1);
+    dynamic_keymap_task();
+    EXPECT_GT(bus_writes, 0);
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(1, 2, 3);
+    EXPECT_EQ(eeprom_contents[(uintptr_t)address], 0x43);
+    EXPECT_EQ(eeprom_contents[(uintptr_t)address + 1], 0x21);
+    EXPECT_EQ(eeprom_contents[(uintptr_t)address + 2], 0x56);
+    EXPECT_EQ(eeprom_contents[(uintptr_t)address + 3], 0x78);
+}
+
+TEST_F(DynamicKeymapTest, CacheFlushWritesPendingChangesImmediately) {
+    // Used before a reset, when there is no time left to wait for the delay
+    dynamic_keymap_set_keycode(3, 5, 15, 0xABCD);
+    dynamic_keymap_cache_flush();
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(3, 5, 15);
+    EXPECT_EQ(eeprom_contents[(uintptr_t)address], 0xAB);
+    EXPECT_EQ(eeprom_contents[(uintptr_t)address + 1], 0xCD);
+
+    bus_writes = 0;
+    dynamic_keymap_cache_flush();
+    advance_time(1000);
+    dynamic_keymap_task();
+    EXPECT_EQ(bus_writes, 0);
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
+TEST_F(DynamicKeymapTest, MacroResetAndBuffer) {
+    uint16_t size = dynamic_keymap_macro_get_buffer_size();
+
+    dynamic_keymap_macro_reset();
+    EXPECT_EQ(bus_writes, PAGE_COUNT(size));
+    for (uint16_t i = 0; i < size; i++) {
+        ASSERT_EQ(eeprom_contents[DYNAMIC_KEYMAP_EEPROM_ADDR + KEYMAP_EEPROM_SIZE + i], 0);
+    }
+
+    uint8_t data[28];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = 'a' + i;
+    }
+    bus_reads  = 0;
+    bus_writes = 0;
+    dynamic_keymap_macro_set_buffer(100, sizeof(data), data);
+    EXPECT_LE(bus_writes, 2);
+
+    uint8_t readback[28];
+    bus_reads = 0;
+    dynamic_keymap_macro_get_buffer(100, sizeof(readback), readback);
+    EXPECT_EQ(bus_reads, 1);
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+}
@@ -22,3 +22,14 @@ eeprom_stm32_SRC := \
 	$(PLATFORM_PATH)/chibios/eeprom_stm32.c
 eeprom_stm32_tiny_SRC := $(eeprom_stm32_SRC)
 eeprom_stm32_large_SRC := $(eeprom_stm32_SRC)
+
+dynamic_keymap_DEFS := -DNO_PRINT -DEEPROM_CUSTOM -DEEPROM_SIZE=2048 -DEXTERNAL_EEPROM_PAGE_SIZE=32 \
+	-DMATRIX_ROWS=6 -DMATRIX_COLS=16 -DDYNAMIC_KEYMAP_ENABLE -DDYNAMIC_KEYMAP_LAYER_COUNT=4 -DDYNAMIC_KEYMAP_EEPROM_ADDR=32
+dynamic_keymap_ram_cache_DEFS := $(dynamic_keymap_DEFS) -DDYNAMIC_KEYMAP_RAM_CACHE -DDYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY=100
+
+dynamic_keymap_SRC := \
+	$(QUANTUM_PATH)/dynamic_keymap.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/dynamic_keymap_tests.cpp
+dynamic_keymap_ram_cache_SRC := $(dynamic_keymap_SRC)
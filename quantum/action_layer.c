@@ -295,6 +295,92 @@ uint8_t read_source_layers_cache(keypos_t key) {
 }
 #endif
 
+#ifdef ACTION_LOOKUP_CACHE
+#    ifndef ACTION_LOOKUP_CACHE_SIZE
+#        define ACTION_LOOKUP_CACHE_SIZE 64
+#    endif
+#    if (ACTION_LOOKUP_CACHE_SIZE & (ACTION_LOOKUP_CACHE_SIZE - 1)) != 0
+#        error "ACTION_LOOKUP_CACHE_SIZE must be a power of two"
+#    endif
+
+/** \brief action lookup cache
+ *
+ * Direct-mapped cache of resolved layers and actions, tagged with the effective
+ * layer state and the key position they were resolved for. Since the layer state
+ * is part of the tag, a layer change selects other entries instead of flushing
+ * the cache, and switching back to a previous layer state finds its entries again.
+ */
+typedef struct {
+    layer_state_t layers;
+    keypos_t      key;
+    uint8_t       layer;
+    bool          valid;
+    action_t      action;
+} action_lookup_cache_entry_t;
+
+static action_lookup_cache_entry_t action_lookup_cache[ACTION_LOOKUP_CACHE_SIZE];
+static action_lookup_cache_stats_t action_lookup_cache_stats;
+// keymap_config the entries were resolved with, as keycode remapping depends on it
+static uint16_t action_lookup_cache_keymap_config = 0;
+
+static uint8_t layer_switch_resolve_layer(keypos_t key);
+
+/** \brief action lookup cache invalidate
+ *
+ * Drops all cached actions, needs to be called whenever the keymap changes
+ */
+void action_lookup_cache_invalidate(void) {
+    for (uint16_t i = 0; i < ACTION_LOOKUP_CACHE_SIZE; i++) {
+        action_lookup_cache[i].valid = false;
+    }
+}
+
+/** \brief action lookup cache get stats
+ *
+ * Gets the number of cache hits and misses since the last clear
+ */
+action_lookup_cache_stats_t action_lookup_cache_get_stats(void) {
+    return action_lookup_cache_stats;
+}
+
+/** \brief action lookup cache clear stats
+ */
+void action_lookup_cache_clear_stats(void) {
+    action_lookup_cache_stats.hits   = 0;
+    action_lookup_cache_stats.misses = 0;
+}
+
+/** \brief action lookup cache lookup
+ *
+ * Gets the cache entry for the key in the current layer state, resolving it on a miss
+ */
+static const action_lookup_cache_entry_t *action_lookup_cache_lookup(keypos_t key) {
+    if (keymap_config.raw != action_lookup_cache_keymap_config) {
+        action_lookup_cache_invalidate();
+        action_lookup_cache_keymap_config = keymap_config.raw;
+    }
+
+    const layer_state_t layers = layer_state | default_layer_state;
+    const uint32_t      state  = layers;
+    const uint8_t       fold   = state ^ (state >> 8) ^ (state >> 16) ^ (state >> 24);
+    const uint16_t      index  = ((uint16_t)(key.row * MATRIX_COLS) + key.col + fold * 37U) & (ACTION_LOOKUP_CACHE_SIZE - 1);
+
+    action_lookup_cache_entry_t *entry = &action_lookup_cache[index];
+    if (entry->valid && entry->layers == layers && entry->key.row == key.row && entry->key.col == key.col) {
+        action_lookup_cache_stats.hits++;
+        return entry;
+    }
+
+    action_lookup_cache_stats.misses++;
+    entry->layers = layers;
+    entry->key    = key;
+    entry->layer  = layer_switch_resolve_layer(key);
+    entry->action = action_for_key(entry->layer, key);
+    entry->valid  = true;
+    return entry;
+}
+#endif // ACTION_LOOKUP_CACHE
+
 /** \brief Store or get action (FIXME: Needs better summary)
  *
  * Make sure the action triggered when the key is released is the same
@@ -311,8 +397,14 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
     uint8_t layer;
 
     if (pressed) {
+#    ifdef ACTION_LOOKUP_CACHE
+        const action_lookup_cache_entry_t *entry = action_lookup_cache_lookup(key);
+        update_source_layers_cache(key, entry->layer);
+        return entry->action;
+#    else
         layer = layer_switch_get_layer(key);
         update_source_layers_cache(key, layer);
+#    endif
     } else {
         layer = read_source_layers_cache(key);
     }
@@ -322,11 +414,11 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+/** \brief Layer switch resolve layer
  *
- * Gets the layer based on key info
+ * Walks the active layers from the top to find the layer of the key
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
+static uint8_t layer_switch_resolve_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
     action_t action;
     action.code = ACTION_TRANSPARENT;
@@ -348,10 +440,26 @@ uint8_t layer_switch_get_layer(keypos_t key) {
 #endif
 }
 
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifdef ACTION_LOOKUP_CACHE
+    return action_lookup_cache_lookup(key)->layer;
+#else
+    return layer_switch_resolve_layer(key);
+#endif
+}
+
 /** \brief Layer switch get layer
  *
  * Gets action code based on key position
  */
 action_t layer_switch_get_action(keypos_t key) {
-    return action_for_key(layer_switch_get_layer(key), key);
+#ifdef ACTION_LOOKUP_CACHE
+    return action_lookup_cache_lookup(key)->action;
+#else
+    return action_for_key(layer_switch_resolve_layer(key), key);
+#endif
 }
@@ -140,6 +140,20 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+#ifdef ACTION_LOOKUP_CACHE
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+} action_lookup_cache_stats_t;
+
+/* drop all cached actions; needed whenever the keymap changes */
+void                        action_lookup_cache_invalidate(void);
+action_lookup_cache_stats_t action_lookup_cache_get_stats(void);
+void                        action_lookup_cache_clear_stats(void);
+#else
+#    define action_lookup_cache_invalidate()
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
@@ -108,6 +108,58 @@ RGB hsv_to_rgb_nocie(HSV hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
 
+// Channel order of each hue region, as indices into {v, p, q, t}. Region 6 is
+// only reached by h == 255 and matches region 0.
+static const uint8_t hsv_region_order[7][3] PROGMEM = {
+    {0, 3, 1}, {2, 0, 1}, {1, 0, 3}, {1, 2, 0}, {3, 1, 0}, {0, 1, 2}, {0, 3, 1},
+};
+
+/* Same results as hsv_to_rgb_impl(), but with the hue region picking the channels
+ * from a table instead of a switch, and without an early return for grays, so the
+ * loop body has no data dependent branches. */
+static inline void hsv_to_rgb_buffer_impl(const HSV *hsv, LED_TYPE *led, uint16_t count, bool use_cie) {
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t h = hsv[i].h;
+        uint16_t s = hsv[i].s;
+        uint16_t v = hsv[i].v;
+#ifdef USE_CIE1931_CURVE
+        if (use_cie) {
+            v = pgm_read_byte(&CIE1931_CURVE[v]);
+        }
+#endif
+
+        uint8_t region    = h * 6 / 255;
+        uint8_t remainder = (h * 2 - region * 85) * 3;
+        // all channels are v without saturation
+        uint8_t gray = -(uint8_t)(s == 0);
+
+        uint8_t values[4];
+        values[0] = v;
+        values[1] = (((v * (255 - s)) >> 8) & ~gray) | (v & gray);
+        values[2] = (((v * (255 - ((s * remainder) >> 8))) >> 8) & ~gray) | (v & gray);
+        values[3] = (((v * (255 - ((s * (255 - remainder)) >> 8))) >> 8) & ~gray) | (v & gray);
+
+        led[i].r = values[pgm_read_byte(&hsv_region_order[region][0])];
+        led[i].g = values[pgm_read_byte(&hsv_region_order[region][1])];
+        led[i].b = values[pgm_read_byte(&hsv_region_order[region][2])];
+#ifdef RGBW
+        led[i].w = 0;
+#endif
+    }
+}
+
+void hsv_to_rgb_buffer(const HSV *hsv, LED_TYPE *led, uint16_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_buffer_impl(hsv, led, count, true);
+#else
+    hsv_to_rgb_buffer_impl(hsv, led, count, false);
+#endif
+}
+
+void hsv_to_rgb_nocie_buffer(const HSV *hsv, LED_TYPE *led, uint16_t count) {
+    hsv_to_rgb_buffer_impl(hsv, led, count, false);
+}
+
 #ifdef RGBW
 #    ifndef MIN
 #        define MIN(a, b) ((a) < (b) ? (a) : (b))
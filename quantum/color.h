@@ -145,6 +145,9 @@ typedef struct PACKED {
 
 RGB hsv_to_rgb(HSV hsv);
 RGB hsv_to_rgb_nocie(HSV hsv);
+// Convert count colors at once, e.g. a whole frame
+void hsv_to_rgb_buffer(const HSV *hsv, LED_TYPE *led, uint16_t count);
+void hsv_to_rgb_nocie_buffer(const HSV *hsv, LED_TYPE *led, uint16_t count);
 #ifdef RGBW
 void convert_rgb_to_rgbw(LED_TYPE *led);
 #endif
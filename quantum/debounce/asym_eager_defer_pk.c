@@ -18,20 +18,14 @@
  */
 
 /*
-Basic symmetric per-key algorithm. Uses an 8-bit counter per key.
+Basic symmetric per-key algorithm. Uses a bit-sliced 7-bit counter per key.
 When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 */
 
 #include "matrix.h"
 #include "timer.h"
 #include "quantum.h"
-#include <stdlib.h>
-
-#ifdef PROTOCOL_CHIBIOS
-#    if CH_CFG_USE_MEMCORE == FALSE
-#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
-#    endif
-#endif
+#include <string.h>
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
@@ -43,39 +37,25 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 #    define DEBOUNCE 127
 #endif
 
-#define ROW_SHIFTER ((matrix_row_t)1)
-
-typedef struct {
-    bool    pressed : 1;
-    uint8_t time : 7;
-} debounce_counter_t;
-
 #if DEBOUNCE > 0
-static debounce_counter_t *debounce_counters;
-static fast_timer_t        last_time;
-static bool                counters_need_update;
-static bool                matrix_need_update;
+#    include "vertical_counter.h"
 
-#    define DEBOUNCE_ELAPSED 0
+static vertical_counter_t debounce_counters[MATRIX_ROWS];
+// [row] keys whose running counter was started by a key-down
+static matrix_row_t debounce_pressed[MATRIX_ROWS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         matrix_need_update;
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
-    debounce_counters = malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
-    for (uint8_t r = 0; r < num_rows; r++) {
-        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
-            debounce_counters[i++].time = DEBOUNCE_ELAPSED;
-        }
-    }
+    memset(debounce_counters, 0, sizeof(debounce_counters));
 }
 
-void debounce_free(void) {
-    free(debounce_counters);
-    debounce_counters = NULL;
-}
+void debounce_free(void) {}
 
 void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
@@ -105,63 +85,44 @@ void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     counters_need_update = false;
     matrix_need_update   = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-
-            if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (debounce_pointer->time <= elapsed_time) {
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        matrix_need_update = true;
-                    } else {
-                        // key-up: defer
-                        cooked[row] = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
-                    }
-                } else {
-                    debounce_pointer->time -= elapsed_time;
-                    counters_need_update = true;
-                }
-            }
-            debounce_pointer++;
+        matrix_row_t expired = vertical_counter_elapse(&debounce_counters[row], elapsed_time);
+
+        if (expired & debounce_pressed[row]) {
+            // key-down: eager
+            matrix_need_update = true;
+        }
+
+        // key-up: defer
+        matrix_row_t released = expired & ~debounce_pressed[row];
+        cooked[row]           = (cooked[row] & ~released) | (raw[row] & released);
+
+        if (vertical_counter_running(&debounce_counters[row])) {
+            counters_need_update = true;
         }
     }
 }
 
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-
-            if (delta & col_mask) {
-                if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
-                    debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
-                    counters_need_update      = true;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        cooked[row] ^= col_mask;
-                    }
-                }
-            } else if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (!debounce_pointer->pressed) {
-                    // key-up: defer
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
-                }
-            }
-            debounce_pointer++;
+        matrix_row_t delta   = raw[row] ^ cooked[row];
+        matrix_row_t running = vertical_counter_running(&debounce_counters[row]);
+        matrix_row_t start   = delta & ~running;
+
+        if (start) {
+            debounce_pressed[row] = (debounce_pressed[row] & ~start) | (raw[row] & start);
+            vertical_counter_load(&debounce_counters[row], start, DEBOUNCE);
+            counters_need_update = true;
+
+            // key-down: eager
+            cooked[row] ^= start & raw[row];
         }
+
+        // key-up: defer
+        vertical_counter_clear(&debounce_counters[row], ~delta & running & ~debounce_pressed[row]);
     }
 }
 
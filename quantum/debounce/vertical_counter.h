@@ -0,0 +1,112 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+Bit-sliced ("vertical") debounce counters for the per-key algorithms.
+
+Instead of one 8-bit counter per key, each row stores one matrix_row_t per
+counter bit: bit N of every key's counter lives in bit_plane[N], at the key's
+column position. Counting down a whole row is then a ripple-borrow subtraction
+over the bit planes, i.e. a handful of word-wide boolean operations per row
+regardless of MATRIX_COLS. A counter value of 0 means the key is debounced.
+
+DEBOUNCE must be defined before including this file.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "matrix.h"
+
+#if DEBOUNCE < 2
+#    define VERTICAL_COUNTER_BITS 1
+#elif DEBOUNCE < 4
+#    define VERTICAL_COUNTER_BITS 2
+#elif DEBOUNCE < 8
+#    define VERTICAL_COUNTER_BITS 3
+#elif DEBOUNCE < 16
+#    define VERTICAL_COUNTER_BITS 4
+#elif DEBOUNCE < 32
+#    define VERTICAL_COUNTER_BITS 5
+#elif DEBOUNCE < 64
+#    define VERTICAL_COUNTER_BITS 6
+#elif DEBOUNCE < 128
+#    define VERTICAL_COUNTER_BITS 7
+#else
+#    define VERTICAL_COUNTER_BITS 8
+#endif
+
+typedef struct {
+    matrix_row_t bit_plane[VERTICAL_COUNTER_BITS];
+} vertical_counter_t;
+
+// Columns of the row whose counter is non-zero.
+static inline matrix_row_t vertical_counter_running(const vertical_counter_t *counter) {
+    matrix_row_t running = 0;
+    for (uint8_t i = 0; i < VERTICAL_COUNTER_BITS; i++) {
+        running |= counter->bit_plane[i];
+    }
+    return running;
+}
+
+// Load `value` into the counters of the columns in `mask`.
+static inline void vertical_counter_load(vertical_counter_t *counter, matrix_row_t mask, uint8_t value) {
+    for (uint8_t i = 0; i < VERTICAL_COUNTER_BITS; i++) {
+        if (value & (1 << i)) {
+            counter->bit_plane[i] |= mask;
+        } else {
+            counter->bit_plane[i] &= ~mask;
+        }
+    }
+}
+
+// Zero the counters of the columns in `mask`.
+static inline void vertical_counter_clear(vertical_counter_t *counter, matrix_row_t mask) {
+    for (uint8_t i = 0; i < VERTICAL_COUNTER_BITS; i++) {
+        counter->bit_plane[i] &= ~mask;
+    }
+}
+
+/* Subtract `elapsed_time` from every running counter of the row.
+ *
+ * Counters that would reach or pass zero are set to zero, and their columns
+ * are returned. Counters that were already zero are left untouched.
+ */
+static inline matrix_row_t vertical_counter_elapse(vertical_counter_t *counter, uint8_t elapsed_time) {
+    matrix_row_t running = vertical_counter_running(counter);
+    if (!running) {
+        return 0;
+    }
+
+    matrix_row_t borrow    = 0;
+    matrix_row_t remaining = 0;
+    for (uint8_t i = 0; i < VERTICAL_COUNTER_BITS; i++) {
+        matrix_row_t a = counter->bit_plane[i];
+        matrix_row_t b = (elapsed_time & (1 << i)) ? ~(matrix_row_t)0 : 0;
+
+        counter->bit_plane[i] = a ^ b ^ borrow;
+        borrow                = (~a & b) | (~(a ^ b) & borrow);
+        remaining |= counter->bit_plane[i];
+    }
+    if (elapsed_time >> VERTICAL_COUNTER_BITS) {
+        // elapsed time is larger than any counter can hold
+        borrow = ~(matrix_row_t)0;
+    }
+
+    matrix_row_t expired = running & (borrow | ~remaining);
+    vertical_counter_clear(counter, ~running | expired);
+    return expired;
+}
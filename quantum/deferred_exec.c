@@ -12,31 +12,117 @@
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap ordered by trigger time: the in-use entries are packed at the start of the
+// table, and the entry at index 0 is always the next one to trigger. Checking whether anything is due is therefore a
+// single comparison, and adding, extending or removing an entry only moves O(log n) entries around.
+//
 
 static deferred_token current_token = 0;
+static uint8_t        tokens_in_use[(1 << (8 * sizeof(deferred_token))) / 8];
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline bool token_is_in_use(deferred_token token) {
+    return tokens_in_use[token / 8] & (1 << (token % 8));
+}
+
+static inline void release_token(deferred_token token) {
+    tokens_in_use[token / 8] &= ~(1 << (token % 8));
+}
+
+static inline deferred_token allocate_token(void) {
+    // Tokens are handed out in sequence, so the next one is almost always free
+    for (uint16_t i = 0; i < (1 << (8 * sizeof(deferred_token))); ++i) {
+        ++current_token;
+        if (current_token != INVALID_DEFERRED_TOKEN && !token_is_in_use(current_token)) {
+            tokens_in_use[current_token / 8] |= (1 << (current_token % 8));
+            return current_token;
+        }
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+    // Everything is already allocated (yikes!). Need to exit with a failure.
+    return INVALID_DEFERRED_TOKEN;
+}
+
+static inline bool triggers_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline void swap_entries(deferred_executor_t *table, size_t a, size_t b) {
+    deferred_executor_t tmp = table[a];
+    table[a]                = table[b];
+    table[b]                = tmp;
+}
+
+static size_t sift_up(deferred_executor_t *table, size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!triggers_before(&table[index], &table[parent])) {
+            break;
         }
+        swap_entries(table, index, parent);
+        index = parent;
     }
-    return true;
+    return index;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void sift_down(deferred_executor_t *table, size_t heap_size, size_t index) {
+    while (true) {
+        size_t earliest = index;
+        size_t left     = 2 * index + 1;
+        size_t right    = left + 1;
+        if (left < heap_size && triggers_before(&table[left], &table[earliest])) {
+            earliest = left;
+        }
+        if (right < heap_size && triggers_before(&table[right], &table[earliest])) {
+            earliest = right;
         }
+        if (earliest == index) {
+            break;
+        }
+        swap_entries(table, index, earliest);
+        index = earliest;
+    }
+}
+
+static inline void reposition_entry(deferred_executor_t *table, size_t heap_size, size_t index) {
+    sift_down(table, heap_size, sift_up(table, index));
+}
+
+// Number of in-use entries; these are always packed at the start of the table.
+static size_t heap_size(deferred_executor_t *table, size_t table_count) {
+    size_t lo = 0, hi = table_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].token == INVALID_DEFERRED_TOKEN) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// Index of the entry with the supplied token, or heap_size if not found.
+static size_t find_entry(deferred_executor_t *table, size_t heap_size, deferred_token token) {
+    for (size_t i = 0; i < heap_size; ++i) {
+        if (table[i].token == token) {
+            return i;
+        }
+    }
+    return heap_size;
+}
+
+static void remove_entry(deferred_executor_t *table, size_t heap_size, size_t index) {
+    size_t last = heap_size - 1;
+    release_token(table[index].token);
+    table[index] = table[last];
+
+    table[last].token        = INVALID_DEFERRED_TOKEN;
+    table[last].trigger_time = 0;
+    table[last].callback     = NULL;
+    table[last].cb_arg       = NULL;
+
+    if (index < last) {
+        reposition_entry(table, last, index);
     }
-    return current_token;
 }
 
 //------------------------------------
@@ -49,27 +135,27 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+    // The first unused slot is just past the end of the heap
+    size_t index = heap_size(table, table_count);
+    if (index == table_count) {
+        // None available
+        return INVALID_DEFERRED_TOKEN;
+    }
 
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token();
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    deferred_executor_t *entry = &table[index];
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    sift_up(table, index);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +165,17 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t size  = heap_size(table, table_count);
+    size_t index = find_entry(table, size, token);
+    if (index == size) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[index].trigger_time = timer_read32() + delay_ms;
+    reposition_entry(table, size, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +185,43 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t size  = heap_size(table, table_count);
+    size_t index = find_entry(table, size, token);
+    if (index == size) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    remove_entry(table, size, index);
+    return true;
+}
+
+static inline bool is_due(const deferred_executor_t *entry, uint32_t now) {
+    return ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0;
+}
+
+static inline bool was_invoked(const uint8_t *invoked, deferred_token token) {
+    return invoked[token / 8] & (1 << (token % 8));
+}
+
+// Index of the earliest due entry that has not been invoked in this pass yet, or heap_size if there is none.
+static size_t next_due_entry(deferred_executor_t *table, size_t heap_size, uint32_t now, const uint8_t *invoked) {
+    if (heap_size == 0 || !is_due(&table[0], now)) {
+        return heap_size;
+    }
+    if (!was_invoked(invoked, table[0].token)) {
+        return 0;
+    }
+
+    // The root has been rescheduled to a time that is still due, which only happens after a stall
+    size_t next = heap_size;
+    for (size_t i = 1; i < heap_size; ++i) {
+        if (is_due(&table[i], now) && !was_invoked(invoked, table[i].token) && (next == heap_size || triggers_before(&table[i], &table[next]))) {
+            next = i;
+        }
+    }
+    return next;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,29 +231,45 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry = &table[i];
-
-            // Check if we're supposed to execute this entry
-            if (entry->token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+        // The root of the heap is the earliest trigger time, so nothing is due as soon as the root isn't
+        if (table[0].token == INVALID_DEFERRED_TOKEN || !is_due(&table[0], now)) {
+            return;
+        }
+
+        // Run the due executors in trigger time order, each at most once per pass, even if an executor that fell behind
+        // is still due after being rescheduled
+        uint8_t invoked[sizeof(tokens_in_use)] = {0};
+        while (true) {
+            size_t size  = heap_size(table, table_count);
+            size_t index = next_due_entry(table, size, now, invoked);
+            if (index == size) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            deferred_executor_t *entry = &table[index];
+            deferred_token       token = entry->token;
+            invoked[token / 8] |= (1 << (token % 8));
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // The callback may have added, extended or cancelled executors in this table, moving this one
+            size  = heap_size(table, table_count);
+            index = (index < size && table[index].token == token) ? index : find_entry(table, size, token);
+            if (index == size) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                table[index].trigger_time += delay_ms;
+                reposition_entry(table, size, index);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                remove_entry(table, size, index);
             }
         }
     }
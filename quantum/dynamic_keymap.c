@@ -14,6 +14,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "keymap.h" // to get keymaps[][][]
 #include "eeprom.h"
 #include "progmem.h" // to read default from flash
@@ -93,52 +94,183 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR - DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + 1)
 #endif
 
+#define DYNAMIC_KEYMAP_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+// Bulk EEPROM writes are split into chunks aligned to this size, so that
+// external EEPROMs only ever see whole or partial single-page transfers.
+#ifndef DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE
+#    ifdef EXTERNAL_EEPROM_PAGE_SIZE
+#        define DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE EXTERNAL_EEPROM_PAGE_SIZE
+#    else
+#        define DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE 32
+#    endif
+#endif
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// Keymap and encoder map are mirrored in RAM as one contiguous copy
+// of their EEPROM region, in the same big-endian layout.
+#    define DYNAMIC_KEYMAP_CACHE_SIZE (DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR - DYNAMIC_KEYMAP_EEPROM_ADDR)
+
+_Static_assert(DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR == DYNAMIC_KEYMAP_EEPROM_ADDR + DYNAMIC_KEYMAP_KEYMAP_EEPROM_SIZE, "DYNAMIC_KEYMAP_RAM_CACHE requires the encoder map to directly follow the keymap in EEPROM.");
+
+// Delay after the last write before dirty bytes are flushed to EEPROM, so
+// bursts of writes (e.g. a full VIA keymap upload) are written in one batch.
+#    ifndef DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY
+#        define DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY 100
+#    endif
+
+static uint8_t  dynamic_keymap_cache[DYNAMIC_KEYMAP_CACHE_SIZE];
+static bool     dynamic_keymap_cache_loaded      = false;
+static uint16_t dynamic_keymap_cache_dirty_start = DYNAMIC_KEYMAP_CACHE_SIZE;
+static uint16_t dynamic_keymap_cache_dirty_end   = 0;
+static uint16_t dynamic_keymap_cache_write_time  = 0;
+
+void dynamic_keymap_cache_load(void) {
+    eeprom_read_block(dynamic_keymap_cache, (void *)(uintptr_t)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_CACHE_SIZE);
+    dynamic_keymap_cache_dirty_start = DYNAMIC_KEYMAP_CACHE_SIZE;
+    dynamic_keymap_cache_dirty_end   = 0;
+    dynamic_keymap_cache_loaded      = true;
+    action_lookup_cache_invalidate();
+}
+
+static uint8_t *dynamic_keymap_cache_pointer(void *address) {
+    if (!dynamic_keymap_cache_loaded) {
+        dynamic_keymap_cache_load();
+    }
+    return &dynamic_keymap_cache[(uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR];
+}
+
+static void dynamic_keymap_cache_mark_dirty(void *address, uint16_t size) {
+    uint16_t offset = (uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR;
+    if (offset < dynamic_keymap_cache_dirty_start) {
+        dynamic_keymap_cache_dirty_start = offset;
+    }
+    if (offset + size > dynamic_keymap_cache_dirty_end) {
+        dynamic_keymap_cache_dirty_end = offset + size;
+    }
+    dynamic_keymap_cache_write_time = timer_read();
+}
+
+void dynamic_keymap_cache_flush(void) {
+    if (dynamic_keymap_cache_dirty_start >= dynamic_keymap_cache_dirty_end) {
+        return;
+    }
+    eeprom_update_block(&dynamic_keymap_cache[dynamic_keymap_cache_dirty_start], (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + dynamic_keymap_cache_dirty_start), dynamic_keymap_cache_dirty_end - dynamic_keymap_cache_dirty_start);
+    dynamic_keymap_cache_dirty_start = DYNAMIC_KEYMAP_CACHE_SIZE;
+    dynamic_keymap_cache_dirty_end   = 0;
+}
+
+void dynamic_keymap_task(void) {
+    if (dynamic_keymap_cache_dirty_start < dynamic_keymap_cache_dirty_end && timer_elapsed(dynamic_keymap_cache_write_time) >= DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY) {
+        dynamic_keymap_cache_flush();
+    }
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
+// Big endian, so we can read/write EEPROM directly from host if we want
+static uint16_t dynamic_keymap_read_keycode(void *address) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    uint8_t *cached = dynamic_keymap_cache_pointer(address);
+    return (cached[0] << 8) | cached[1];
+#else
+    uint16_t keycode = eeprom_read_byte(address) << 8;
+    keycode |= eeprom_read_byte(address + 1);
+    return keycode;
+#endif
+}
+
+static void dynamic_keymap_write_keycode(void *address, uint16_t keycode) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    uint8_t *cached = dynamic_keymap_cache_pointer(address);
+    cached[0]       = (uint8_t)(keycode >> 8);
+    cached[1]       = (uint8_t)(keycode & 0xFF);
+    dynamic_keymap_cache_mark_dirty(address, 2);
+#else
+    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
+    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif
+    action_lookup_cache_invalidate();
+}
+
+static void dynamic_keymap_read_block(uint8_t *data, void *address, uint16_t size) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    memcpy(data, dynamic_keymap_cache_pointer(address), size);
+#else
+    eeprom_read_block(data, address, size);
+#endif
+}
+
+static void dynamic_keymap_update_block(const uint8_t *data, void *address, uint16_t size) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    memcpy(dynamic_keymap_cache_pointer(address), data, size);
+    dynamic_keymap_cache_mark_dirty(address, size);
+#else
+    eeprom_update_block(data, address, size);
+#endif
+    action_lookup_cache_invalidate();
+}
+
+// Collects consecutive bytes and hands them to dynamic_keymap_update_block()
+// in chunks that never cross a DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE boundary.
+typedef struct {
+    uintptr_t address;
+    uint16_t  length;
+    uint8_t   data[DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE];
+} dynamic_keymap_writer_t;
+
+static void dynamic_keymap_writer_flush(dynamic_keymap_writer_t *writer) {
+    if (writer->length) {
+        dynamic_keymap_update_block(writer->data, (void *)writer->address, writer->length);
+        writer->address += writer->length;
+        writer->length = 0;
+    }
+}
+
+static void dynamic_keymap_writer_put_keycode(dynamic_keymap_writer_t *writer, uint16_t keycode) {
+    // Big endian, so we can read/write EEPROM directly from host if we want
+    uint8_t bytes[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    for (uint8_t i = 0; i < 2; i++) {
+        writer->data[writer->length++] = bytes[i];
+        if ((writer->address + writer->length) % DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE == 0) {
+            dynamic_keymap_writer_flush(writer);
+        }
+    }
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
 void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
     // TODO: optimize this with some left shifts
-    return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    return ((void *)(uintptr_t)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
-    void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
-    // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = eeprom_read_byte(address) << 8;
-    keycode |= eeprom_read_byte(address + 1);
-    return keycode;
+    return dynamic_keymap_read_keycode(dynamic_keymap_key_to_eeprom_address(layer, row, column));
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
-    void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
-    // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    dynamic_keymap_write_keycode(dynamic_keymap_key_to_eeprom_address(layer, row, column), keycode);
 }
 
 #ifdef ENCODER_MAP_ENABLE
 void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id) {
-    return ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2);
+    return ((void *)(uintptr_t)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2);
 }
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
-    // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
-    keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
-    return keycode;
+    return dynamic_keymap_read_keycode(address + (clockwise ? 0 : 2));
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
-    // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    dynamic_keymap_write_keycode(address + (clockwise ? 0 : 2), keycode);
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -146,46 +278,45 @@ void dynamic_keymap_reset(void) {
     // Reset the keymaps in EEPROM to what is in flash.
     // All keyboards using dynamic keymaps should define a layout
     // for the same number of layers as DYNAMIC_KEYMAP_LAYER_COUNT.
+    dynamic_keymap_writer_t writer = {.address = DYNAMIC_KEYMAP_EEPROM_ADDR};
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
             for (int column = 0; column < MATRIX_COLS; column++) {
-                dynamic_keymap_set_keycode(layer, row, column, pgm_read_word(&keymaps[layer][row][column]));
+                dynamic_keymap_writer_put_keycode(&writer, pgm_read_word(&keymaps[layer][row][column]));
             }
         }
+    }
+    dynamic_keymap_writer_flush(&writer);
 #ifdef ENCODER_MAP_ENABLE
+    writer.address = DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR;
+    for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int encoder = 0; encoder < NUM_ENCODERS; encoder++) {
-            dynamic_keymap_set_encoder(layer, encoder, true, pgm_read_word(&encoder_map[layer][encoder][0]));
-            dynamic_keymap_set_encoder(layer, encoder, false, pgm_read_word(&encoder_map[layer][encoder][1]));
+            dynamic_keymap_writer_put_keycode(&writer, pgm_read_word(&encoder_map[layer][encoder][0]));
+            dynamic_keymap_writer_put_keycode(&writer, pgm_read_word(&encoder_map[layer][encoder][1]));
         }
-#endif // ENCODER_MAP_ENABLE
     }
+    dynamic_keymap_writer_flush(&writer);
+#endif // ENCODER_MAP_ENABLE
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // Persist immediately, callers may mark the EEPROM valid right after this.
+    dynamic_keymap_cache_flush();
+#endif
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_KEYMAP_EEPROM_SIZE;
+    uint16_t valid_size                 = offset < dynamic_keymap_eeprom_size ? MIN(size, dynamic_keymap_eeprom_size - offset) : 0;
+    if (valid_size) {
+        dynamic_keymap_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), valid_size);
     }
+    memset(data + valid_size, 0x00, size - valid_size);
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_KEYMAP_EEPROM_SIZE;
+    uint16_t valid_size                 = offset < dynamic_keymap_eeprom_size ? MIN(size, dynamic_keymap_eeprom_size - offset) : 0;
+    if (valid_size) {
+        dynamic_keymap_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), valid_size);
     }
 }
 
@@ -213,37 +344,31 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t valid_size = offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE ? MIN(size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset) : 0;
+    if (valid_size) {
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), valid_size);
     }
+    memset(data + valid_size, 0x00, size - valid_size);
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+    uint16_t valid_size = offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE ? MIN(size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset) : 0;
+    if (valid_size) {
+        eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), valid_size);
     }
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    uint8_t   zeros[DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE] = {0};
+    uintptr_t p                                       = DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR;
+    uintptr_t end                                     = DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE;
     while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+        uint16_t length = DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE - (p % DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE);
+        if (length > end - p) {
+            length = end - p;
+        }
+        eeprom_update_block(zeros, (void *)p, length);
+        p += length;
     }
 }
 
@@ -256,15 +381,15 @@ void dynamic_keymap_macro_send(uint8_t id) {
     // If it's not zero, then we are in the middle
     // of buffer writing, possibly an aborted buffer
     // write. So do nothing.
-    void *p = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
+    void *p = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
     if (eeprom_read_byte(p) != 0) {
         return;
     }
 
     // Skip N null characters
     // p will then point to the Nth macro
-    p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    p         = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
+    void *end = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
     while (id > 0) {
         // If we are past the end of the buffer, then the buffer
         // contents are garbage, i.e. there were not DYNAMIC_KEYMAP_MACRO_COUNT
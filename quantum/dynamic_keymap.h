@@ -27,6 +27,16 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
 void     dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode);
 #endif // ENCODER_MAP_ENABLE
 void dynamic_keymap_reset(void);
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// With DYNAMIC_KEYMAP_RAM_CACHE the keymap and encoder map are served from a
+// RAM copy, so key lookups never touch the EEPROM driver. Writes update the
+// copy immediately and are flushed to EEPROM in a single batch once no further
+// writes happened for DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY milliseconds.
+void dynamic_keymap_cache_load(void);
+void dynamic_keymap_cache_flush(void);
+void dynamic_keymap_task(void);
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 // These get/set the keycodes as stored in the EEPROM buffer
 // Data is big-endian 16-bit values (the keycodes)
 // Order is by layer/row/column
@@ -425,30 +425,92 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+#ifdef MATRIX_EVENT_SCAN
+#    ifndef MATRIX_EVENT_BUFFER_SIZE
+#        define MATRIX_EVENT_BUFFER_SIZE 16
+#    endif
+
+/** \brief Collect the key changes detected by the last matrix scan
+ *
+ * Only the set bits of each row's change mask are visited. The matrix only
+ * reports which keys changed since the previous scan, not when, so every
+ * change is stamped with the same time. Changes that do not fit into the
+ * buffer stay pending in matrix_prev and are collected on the next call,
+ * with that call's time.
+ */
+static uint8_t matrix_scan_events(matrix_row_t matrix_prev[], keyevent_t events[], uint8_t max_events, uint16_t time) {
+    uint8_t event_count = 0;
+
+    for (uint8_t r = 0; r < MATRIX_ROWS && event_count < max_events; r++) {
+        matrix_row_t matrix_row    = matrix_get_row(r);
+        matrix_row_t matrix_change = matrix_row ^ matrix_prev[r];
+        if (!matrix_change) {
+            continue;
+        }
+#    ifdef MATRIX_HAS_GHOST
+        if (has_ghost_in_row(r, matrix_row)) {
+            continue;
+        }
+#    endif
+        do {
+            uint8_t      c        = __builtin_ctzl(matrix_change);
+            matrix_row_t col_mask = (matrix_row_t)1 << c;
+
+            events[event_count++] = (keyevent_t){.key = (keypos_t){.row = r, .col = c}, .pressed = (matrix_row & col_mask), .time = time};
+
+            // record a processed key
+            matrix_prev[r] ^= col_mask;
+            matrix_change &= matrix_change - 1;
+        } while (matrix_change && event_count < max_events);
+    }
+
+    return event_count;
+}
+#endif
+
 /** \brief Perform scan of keyboard matrix
  *
  * Any detected changes in state are sent out as part of the processing
  */
 bool matrix_scan_task(void) {
     static matrix_row_t matrix_prev[MATRIX_ROWS];
-    matrix_row_t        matrix_row    = 0;
-    matrix_row_t        matrix_change = 0;
-#ifdef QMK_KEYS_PER_SCAN
-    uint8_t keys_processed = 0;
-#endif
 
     uint8_t matrix_changed = matrix_scan();
     if (matrix_changed) last_matrix_activity_trigger();
 
+#ifdef MATRIX_EVENT_SCAN
+    keyevent_t events[MATRIX_EVENT_BUFFER_SIZE];
+    uint8_t    event_count = matrix_scan_events(matrix_prev, events, MATRIX_EVENT_BUFFER_SIZE, timer_read() | 1 /* time should not be 0 */);
+
+    if (event_count) {
+        if (debug_matrix) matrix_print();
+        // drain every change of this scan in a single pass
+        for (uint8_t i = 0; i < event_count; i++) {
+            if (should_process_keypress()) {
+                action_exec(events[i]);
+            }
+            switch_events(events[i].key.row, events[i].key.col, events[i].pressed);
+        }
+    } else {
+        // call with pseudo tick event when no real key event.
+        action_exec(TICK_EVENT);
+    }
+#else
+    matrix_row_t matrix_row    = 0;
+    matrix_row_t matrix_change = 0;
+#    ifdef QMK_KEYS_PER_SCAN
+    uint8_t keys_processed = 0;
+#    endif
+
     for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
         matrix_row    = matrix_get_row(r);
         matrix_change = matrix_row ^ matrix_prev[r];
         if (matrix_change) {
-#ifdef MATRIX_HAS_GHOST
+#    ifdef MATRIX_HAS_GHOST
             if (has_ghost_in_row(r, matrix_row)) {
                 continue;
             }
-#endif
+#    endif
             if (debug_matrix) matrix_print();
             matrix_row_t col_mask = 1;
             for (uint8_t c = 0; c < MATRIX_COLS; c++, col_mask <<= 1) {
@@ -463,10 +525,10 @@ bool matrix_scan_task(void) {
 
                     switch_events(r, c, (matrix_row & col_mask));
 
-#ifdef QMK_KEYS_PER_SCAN
+#    ifdef QMK_KEYS_PER_SCAN
                     // only jump out if we have processed "enough" keys.
                     if (++keys_processed >= QMK_KEYS_PER_SCAN)
-#endif
+#    endif
                         // process a key per task call
                         goto MATRIX_LOOP_END;
                 }
@@ -474,13 +536,14 @@ bool matrix_scan_task(void) {
         }
     }
     // call with pseudo tick event when no real key event.
-#ifdef QMK_KEYS_PER_SCAN
+#    ifdef QMK_KEYS_PER_SCAN
     // we can get here with some keys processed now.
     if (!keys_processed)
-#endif
+#    endif
         action_exec(TICK_EVENT);
 
 MATRIX_LOOP_END:
+#endif
 
     matrix_scan_perf_task();
     return matrix_changed;
@@ -641,6 +704,10 @@ void keyboard_task(void) {
     midi_task();
 #endif
 
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_CACHE)
+    dynamic_keymap_task();
+#endif
+
 #ifdef VELOCIKEY_ENABLE
     if (velocikey_enabled()) {
         velocikey_decelerate();
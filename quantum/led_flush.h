@@ -0,0 +1,31 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include "i2c_master.h"
+
+/* Called first by the flush() of the LED and RGB Matrix I2C drivers. With queued
+ * I2C transmits, a flush is skipped while the previous one is still being sent;
+ * the LEDs changed in the meantime stay dirty and go out with the next flush. */
+static inline bool led_flush_deferred(void) {
+#ifdef I2C_ASYNC_ENABLE
+    return i2c_async_busy();
+#else
+    return false;
+#endif
+}
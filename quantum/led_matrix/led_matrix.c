@@ -93,26 +93,6 @@ uint32_t       g_led_timer;
 #ifdef LED_MATRIX_FRAMEBUFFER_EFFECTS
 uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // LED_MATRIX_FRAMEBUFFER_EFFECTS
-#ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-last_hit_t g_last_hit_tracker;
-#endif // LED_MATRIX_KEYREACTIVE_ENABLED
-
-// internals
-static bool            suspend_state     = false;
-static uint8_t         led_last_enable   = UINT8_MAX;
-static uint8_t         led_last_effect   = UINT8_MAX;
-static effect_params_t led_effect_params = {0, LED_FLAG_ALL, false};
-static led_task_states led_task_state    = SYNCING;
-#if LED_DISABLE_TIMEOUT > 0
-static uint32_t led_anykey_timer;
-#endif // LED_DISABLE_TIMEOUT > 0
-
-// double buffers
-static uint32_t led_timer_buffer;
-#ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-static last_hit_t last_hit_buffer;
-#endif // LED_MATRIX_KEYREACTIVE_ENABLED
-
 // split led matrix
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 const uint8_t k_led_matrix_split[2] = LED_MATRIX_SPLIT;
@@ -157,37 +137,66 @@ uint8_t led_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
+// rendering core
+#define LED_RENDER_CORE_NAME(name) led_##name
+#define LED_RENDER_CORE_PIXEL_TYPE uint8_t
+#define LED_RENDER_CORE_PIXEL_OFF 0
+#define LED_RENDER_CORE_DRIVER_SET(i, pixel) led_matrix_driver.set_value(i, pixel)
+#define LED_RENDER_CORE_DRIVER_SET_ALL(pixel) led_matrix_driver.set_value_all(pixel)
+#define LED_RENDER_CORE_DRIVER_FLUSH() led_matrix_driver.flush()
+#ifdef USE_CIE1931_CURVE
+#    define LED_RENDER_CORE_PIXEL_MAP(pixel) pgm_read_byte(&CIE1931_CURVE[pixel])
+#endif
+#define LED_RENDER_CORE_CONFIG led_matrix_eeconfig
+#define LED_RENDER_CORE_TIMER g_led_timer
+#define LED_RENDER_CORE_FLUSH_LIMIT LED_MATRIX_LED_FLUSH_LIMIT
+#define LED_RENDER_CORE_DISABLE_TIMEOUT LED_DISABLE_TIMEOUT
+#define LED_RENDER_CORE_SYNC() eeconfig_flush_led_matrix(false)
+#define LED_RENDER_CORE_INDICATORS(params)      \
+    do {                                        \
+        led_matrix_indicators();                \
+        led_matrix_indicators_advanced(params); \
+    } while (0)
+#ifdef LED_MATRIX_KEYREACTIVE_ENABLED
+#    define LED_RENDER_CORE_KEYREACTIVE
+#endif
+#if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+#    define LED_RENDER_CORE_SPLIT
+#endif
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+#    define LED_RENDER_CORE_RENDER_BUDGET_US LED_MATRIX_RENDER_BUDGET_US
+#    define LED_RENDER_CORE_PROCESS_LIMIT g_led_matrix_led_process_limit
+#    define LED_RENDER_CORE_RENDER_STATS_TYPE led_matrix_render_stats_t
+#endif
+#include "led_render_core.inc"
+
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+led_matrix_render_stats_t led_matrix_get_render_stats(void) {
+    return led_get_render_stats();
+}
+
+void led_matrix_clear_render_stats(void) {
+    led_clear_render_stats();
+}
+#endif
+
 void led_matrix_update_pwm_buffers(void) {
-    led_matrix_driver.flush();
+    led_flush_pixels();
 }
 
 void led_matrix_set_value(int index, uint8_t value) {
-#ifdef USE_CIE1931_CURVE
-    value = pgm_read_byte(&CIE1931_CURVE[value]);
-#endif
-    led_matrix_driver.set_value(index, value);
+    led_set_pixel(index, value);
 }
 
 void led_matrix_set_value_all(uint8_t value) {
-#if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
-    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++)
-        led_matrix_set_value(i, value);
-#else
-#    ifdef USE_CIE1931_CURVE
-    led_matrix_driver.set_value_all(pgm_read_byte(&CIE1931_CURVE[value]));
-#    else
-    led_matrix_driver.set_value_all(value);
-#    endif
-#endif
+    led_set_pixel_all(value);
 }
 
 void process_led_matrix(uint8_t row, uint8_t col, bool pressed) {
 #ifndef LED_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
 #endif
-#if LED_DISABLE_TIMEOUT > 0
-    led_anykey_timer = 0;
-#endif // LED_DISABLE_TIMEOUT > 0
+    led_task_keypress();
 
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
     uint8_t led[LED_HITS_TO_REMEMBER];
@@ -202,22 +211,7 @@ void process_led_matrix(uint8_t row, uint8_t col, bool pressed) {
         led_count = led_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
-    for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
-    }
+    led_last_hit_add(led, led_count);
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 #if defined(LED_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_LED_MATRIX_TYPING_HEATMAP)
@@ -236,63 +230,9 @@ static bool led_matrix_none(effect_params_t *params) {
     return false;
 }
 
-static void led_task_timers(void) {
-#if defined(LED_MATRIX_KEYREACTIVE_ENABLED) || LED_DISABLE_TIMEOUT > 0
-    uint32_t deltaTime = sync_timer_elapsed32(led_timer_buffer);
-#endif // defined(LED_MATRIX_KEYREACTIVE_ENABLED) || LED_DISABLE_TIMEOUT > 0
-    led_timer_buffer = sync_timer_read32();
-
-    // Update double buffer timers
-#if LED_DISABLE_TIMEOUT > 0
-    if (led_anykey_timer < UINT32_MAX) {
-        if (UINT32_MAX - deltaTime < led_anykey_timer) {
-            led_anykey_timer = UINT32_MAX;
-        } else {
-            led_anykey_timer += deltaTime;
-        }
-    }
-#endif // LED_DISABLE_TIMEOUT > 0
-
-    // Update double buffer last hit timers
-#ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
-    }
-#endif // LED_MATRIX_KEYREACTIVE_ENABLED
-}
-
-static void led_task_sync(void) {
-    eeconfig_flush_led_matrix(false);
-    // next task
-    if (sync_timer_elapsed32(g_led_timer) >= LED_MATRIX_LED_FLUSH_LIMIT) led_task_state = STARTING;
-}
-
-static void led_task_start(void) {
-    // reset iter
-    led_effect_params.iter = 0;
-
-    // update double buffers
-    g_led_timer = led_timer_buffer;
-#ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
-#endif // LED_MATRIX_KEYREACTIVE_ENABLED
-
-    // next task
-    led_task_state = RENDERING;
-}
-
 static void led_task_render(uint8_t effect) {
-    bool rendering         = false;
-    led_effect_params.init = (effect != led_last_effect) || (led_matrix_eeconfig.enable != led_last_enable);
-    if (led_effect_params.flags != led_matrix_eeconfig.flags) {
-        led_effect_params.flags = led_matrix_eeconfig.flags;
-        led_matrix_set_value_all(0);
-    }
+    bool rendering = false;
+    led_task_render_begin(effect);
 
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
@@ -327,61 +267,11 @@ static void led_task_render(uint8_t effect) {
             // ---------------------------------------------
     }
 
-    led_effect_params.iter++;
-
-    // next task
-    if (!rendering) {
-        led_task_state = FLUSHING;
-        if (!led_effect_params.init && effect == LED_MATRIX_NONE) {
-            // We only need to flush once if we are LED_MATRIX_NONE
-            led_task_state = SYNCING;
-        }
-    }
-}
-
-static void led_task_flush(uint8_t effect) {
-    // update last trackers after the first full render so we can init over several frames
-    led_last_effect = effect;
-    led_last_enable = led_matrix_eeconfig.enable;
-
-    // update pwm buffers
-    led_matrix_update_pwm_buffers();
-
-    // next task
-    led_task_state = SYNCING;
+    led_task_render_end(effect, rendering);
 }
 
 void led_matrix_task(void) {
-    led_task_timers();
-
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
-    bool suspend_backlight = suspend_state ||
-#if LED_DISABLE_TIMEOUT > 0
-                             (led_anykey_timer > (uint32_t)LED_DISABLE_TIMEOUT) ||
-#endif // LED_DISABLE_TIMEOUT > 0
-                             false;
-
-    uint8_t effect = suspend_backlight || !led_matrix_eeconfig.enable ? 0 : led_matrix_eeconfig.mode;
-
-    switch (led_task_state) {
-        case STARTING:
-            led_task_start();
-            break;
-        case RENDERING:
-            led_task_render(effect);
-            if (effect) {
-                led_matrix_indicators();
-                led_matrix_indicators_advanced(&led_effect_params);
-            }
-            break;
-        case FLUSHING:
-            led_task_flush(effect);
-            break;
-        case SYNCING:
-            led_task_sync();
-            break;
-    }
+    led_task_run();
 }
 
 void led_matrix_indicators(void) {
@@ -399,7 +289,7 @@ void led_matrix_indicators_advanced(effect_params_t *params) {
      * and not sure which would be better. Otherwise, this should be called from
      * led_task_render, right before the iter++ line.
      */
-#if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#if defined(LED_MATRIX_PROCESS_IN_CHUNKS)
     uint8_t min = LED_MATRIX_LED_PROCESS_LIMIT * (params->iter - 1);
     uint8_t max = min + LED_MATRIX_LED_PROCESS_LIMIT;
     if (max > DRIVER_LED_TOTAL) max = DRIVER_LED_TOTAL;
@@ -419,15 +309,7 @@ void led_matrix_init(void) {
     led_matrix_driver.init();
 
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        g_last_hit_tracker.tick[i] = UINT16_MAX;
-    }
-
-    last_hit_buffer.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        last_hit_buffer.tick[i] = UINT16_MAX;
-    }
+    led_last_hit_init();
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     if (!eeconfig_is_enabled()) {
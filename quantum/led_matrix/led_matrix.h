@@ -38,11 +38,21 @@
 #    define LED_MATRIX_LED_FLUSH_LIMIT 16
 #endif
 
-#ifndef LED_MATRIX_LED_PROCESS_LIMIT
-#    define LED_MATRIX_LED_PROCESS_LIMIT (DRIVER_LED_TOTAL + 4) / 5
+#if defined(LED_MATRIX_RENDER_BUDGET_US)
+// Picked for every frame from the measured render cost, see led_render_core.inc
+#    undef LED_MATRIX_LED_PROCESS_LIMIT
+#    define LED_MATRIX_LED_PROCESS_LIMIT g_led_matrix_led_process_limit
+#    define LED_MATRIX_PROCESS_IN_CHUNKS
+#else
+#    ifndef LED_MATRIX_LED_PROCESS_LIMIT
+#        define LED_MATRIX_LED_PROCESS_LIMIT (DRIVER_LED_TOTAL + 4) / 5
+#    endif
+#    if LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#        define LED_MATRIX_PROCESS_IN_CHUNKS
+#    endif
 #endif
 
-#if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#if defined(LED_MATRIX_PROCESS_IN_CHUNKS)
 #    if defined(LED_MATRIX_SPLIT)
 #        define LED_MATRIX_USE_LIMITS(min, max)                                                   \
             uint8_t min = LED_MATRIX_LED_PROCESS_LIMIT * params->iter;                            \
@@ -159,6 +169,18 @@ void        led_matrix_decrease_speed_noeeprom(void);
 led_flags_t led_matrix_get_flags(void);
 void        led_matrix_set_flags(led_flags_t flags);
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+typedef struct {
+    uint16_t fps;               // frames flushed per second, updated every second
+    uint16_t last_render_us;    // duration of the last render iteration
+    uint32_t overruns;          // render iterations that took longer than LED_MATRIX_RENDER_BUDGET_US
+    uint8_t  led_process_limit; // LEDs rendered per iteration in the current frame
+} led_matrix_render_stats_t;
+
+led_matrix_render_stats_t led_matrix_get_render_stats(void);
+void                      led_matrix_clear_render_stats(void);
+#endif
+
 typedef struct {
     /* Perform any initialisation required for the other driver functions to work. */
     void (*init)(void);
@@ -189,6 +211,9 @@ extern led_eeconfig_t led_matrix_eeconfig;
 
 extern uint32_t     g_led_timer;
 extern led_config_t g_led_config;
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+extern uint8_t g_led_matrix_led_process_limit;
+#endif
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
@@ -27,6 +27,7 @@
 
 #if defined(IS31FL3731) || defined(IS31FL3733) || defined(IS31FLCOMMON)
 #    include "i2c_master.h"
+#    include "led_flush.h"
 
 static void init(void) {
     i2c_init();
@@ -155,6 +156,9 @@ const led_matrix_driver_t led_matrix_driver = {
 
 #    elif defined(IS31FL3733)
 static void flush(void) {
+    if (led_flush_deferred()) {
+        return;
+    }
     IS31FL3733_update_pwm_buffers(LED_DRIVER_ADDR_1, 0);
 #        if defined(LED_DRIVER_ADDR_2)
     IS31FL3733_update_pwm_buffers(LED_DRIVER_ADDR_2, 1);
@@ -56,6 +56,22 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 32
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+/**
+ * @def This controls whether the pixel data buffer is double-buffered. When enabled, the next block of pixel data is
+ *      decoded into one buffer while the other is still being transmitted, on transports capable of sending without
+ *      blocking (currently SPI on ChibiOS, using DMA). Doubles the RAM used for the pixel data buffer, and requires a
+ *      QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE of at least 256. Draws remain blocking: this shortens them, but the matrix
+ *      is still not scanned while one is in progress.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER FALSE
+#endif
+
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER && QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE < 256
+// With smaller blocks, decoding and DMA overlap too briefly to be worth the second buffer
+#    error QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER requires QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE to be at least 256
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -64,6 +80,32 @@
 #    define QUANTUM_PAINTER_SUPPORTS_256_PALETTE FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_SUPPORTS_LZ
+/**
+ * @def This controls whether images and fonts using QMK LZ compression can be drawn. Decoding keeps a window of the
+ *      last 256 bytes of pixel data in RAM.
+ */
+#    define QUANTUM_PAINTER_SUPPORTS_LZ FALSE
+#endif
+
+#ifndef QUANTUM_PAINTER_NUM_CACHED_GLYPHS
+/**
+ * @def This controls the number of rendered glyphs kept in RAM by text drawing, so that text which is redrawn often,
+ *      such as counters or clocks, doesn't need to be decoded again. The least recently used glyph is replaced when
+ *      full. Each entry requires QUANTUM_PAINTER_CACHED_GLYPH_SIZE bytes of RAM, plus a small header. Setting this
+ *      to zero disables the cache.
+ */
+#    define QUANTUM_PAINTER_NUM_CACHED_GLYPHS 0
+#endif
+
+#ifndef QUANTUM_PAINTER_CACHED_GLYPH_SIZE
+/**
+ * @def This controls the maximum size of a cached glyph, in bytes of the display's native pixel format. Glyphs which
+ *      are larger are decoded every time they're drawn.
+ */
+#    define QUANTUM_PAINTER_CACHED_GLYPH_SIZE 256
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
@@ -10,7 +10,14 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+extern uint8_t *qp_internal_global_pixdata_buffer;
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
+
+// Transmits the pixels in the global pixdata buffer, then moves on to the next buffer if double-buffered.
+bool qp_internal_send_pixdata_buffer(painter_device_t device, uint32_t native_pixel_count);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -27,9 +34,24 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Maximum number of bytes handed over by an input callback in one span
+#define QP_INTERNAL_SPAN_MAX_BYTES 32
+
+// Maximum number of palette indices handed over to an output callback in one call, a multiple of 8 so runs stay byte-aligned
+#define QP_INTERNAL_DECODE_CHUNK_PIXELS 64
+
+// A span of encoded pixel bytes -- either `length` bytes as-is, or a run of `length` copies of bytes[0]
+struct qp_internal_byte_span {
+    uint8_t length;
+    bool    is_run;
+    uint8_t bytes[QP_INTERNAL_SPAN_MAX_BYTES];
+};
+
 // Convert from input pixel data + palette to equivalent pixels
-typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
-typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+// The input callback supplies the next span of at most max_bytes bytes, returning false on error or end of stream.
+// The output callback receives count palette indices, or if is_fill is set, count copies of indices[0].
+typedef bool (*qp_internal_byte_input_callback)(void* cb_arg, struct qp_internal_byte_span* span, uint8_t max_bytes);
+typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, const uint8_t* indices, uint32_t count, bool is_fill, void* cb_arg);
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg);
@@ -59,8 +81,12 @@ enum qp_internal_rle_mode_t {
     MARKER_BYTE,
     REPEATING_RUN,
     NON_REPEATING_RUN,
+    BACK_REFERENCE,
 };
 
+// Number of previously-decoded bytes LZ back references can reach -- fixed by the format, and indexed with a uint8_t
+#define QP_INTERNAL_LZ_WINDOW_SIZE 256
+
 struct qp_internal_byte_input_state {
     painter_device_t device;
     qp_stream_t*     src_stream;
@@ -71,6 +97,13 @@ struct qp_internal_byte_input_state {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            enum qp_internal_rle_mode_t mode;
+            uint8_t                     remain;    // number of bytes remaining in the current mode
+            uint8_t                     distance;  // back reference distance, minus one
+            uint8_t                     write_pos; // position of the next decoded byte in the window
+        } lz;
     };
 };
 
@@ -80,6 +113,6 @@ struct qp_internal_pixel_output_state {
     uint32_t         max_pixels;
 };
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+bool qp_internal_pixel_appender(qp_pixel_t* palette, const uint8_t* indices, uint32_t count, bool is_fill, void* cb_arg);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(struct qp_internal_byte_input_state* input_state, painter_compression_t compression);
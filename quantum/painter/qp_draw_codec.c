@@ -28,22 +28,64 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
 }
 
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
-    const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
-    uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+    const uint8_t                pixel_bitmask    = (1 << bits_per_pixel) - 1;
+    const uint8_t                pixels_per_byte  = 8 / bits_per_pixel;
+    uint32_t                     remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+    struct qp_internal_byte_span span;
+    uint8_t                      indices[QP_INTERNAL_DECODE_CHUNK_PIXELS];
     while (remaining_pixels > 0) {
-        uint8_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
+        // Never ask for more bytes than the pixels need, the rest of the stream may belong to something else
+        uint32_t remaining_bytes = (remaining_pixels + pixels_per_byte - 1) / pixels_per_byte;
+        if (!input_callback(input_arg, &span, QP_MIN(remaining_bytes, QP_INTERNAL_SPAN_MAX_BYTES))) {
             return false;
         }
-        uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
-        for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
-                return false;
+
+        uint32_t span_pixels = QP_MIN((uint32_t)span.length * pixels_per_byte, remaining_pixels);
+        remaining_pixels -= span_pixels;
+
+        if (span.is_run) {
+            uint8_t byteval = span.bytes[0];
+
+            // A run of bytes made of identical pixels is a single fill
+            indices[0] = byteval & pixel_bitmask;
+            if (byteval == indices[0] * (0xFF / pixel_bitmask)) {
+                if (!output_callback(palette, indices, span_pixels, true, output_arg)) {
+                    return false;
+                }
+                continue;
+            }
+
+            // Otherwise the pixels of the byte are unpacked once, and the pattern repeated
+            for (uint8_t i = 0; i < QP_INTERNAL_DECODE_CHUNK_PIXELS; ++i) {
+                indices[i] = (byteval >> ((i % pixels_per_byte) * bits_per_pixel)) & pixel_bitmask;
+            }
+            while (span_pixels > 0) {
+                uint32_t chunk_pixels = QP_MIN(span_pixels, QP_INTERNAL_DECODE_CHUNK_PIXELS);
+                if (!output_callback(palette, indices, chunk_pixels, false, output_arg)) {
+                    return false;
+                }
+                span_pixels -= chunk_pixels;
+            }
+        } else {
+            uint8_t chunk_pixels = 0;
+            for (uint8_t i = 0; span_pixels > 0; ++i) {
+                uint8_t byteval     = span.bytes[i];
+                uint8_t loop_pixels = QP_MIN(span_pixels, pixels_per_byte);
+                for (uint8_t q = 0; q < loop_pixels; ++q) {
+                    indices[chunk_pixels++] = byteval & pixel_bitmask;
+                    byteval >>= bits_per_pixel;
+                }
+                span_pixels -= loop_pixels;
+
+                // Hand over the indices once there's no room left for another byte's worth
+                if (span_pixels == 0 || chunk_pixels > QP_INTERNAL_DECODE_CHUNK_PIXELS - pixels_per_byte) {
+                    if (!output_callback(palette, indices, chunk_pixels, false, output_arg)) {
+                        return false;
+                    }
+                    chunk_pixels = 0;
+                }
             }
-            byteval >>= bits_per_pixel;
         }
-        remaining_pixels -= loop_pixels;
     }
     return true;
 }
@@ -67,63 +109,190 @@ bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, u
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Progressive pull of bytes, push of pixels
 
-static inline int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg) {
+static inline bool qp_drawimage_byte_uncompressed_decoder(void* cb_arg, struct qp_internal_byte_span* span, uint8_t max_bytes) {
     struct qp_internal_byte_input_state* state = (struct qp_internal_byte_input_state*)cb_arg;
-    state->curr                                = qp_stream_get(state->src_stream);
-    return state->curr;
+    span->is_run                               = false;
+    span->length                               = qp_stream_read(span->bytes, 1, max_bytes, state->src_stream);
+    return span->length == max_bytes;
 }
 
-static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
+static inline bool qp_drawimage_byte_rle_decoder(void* cb_arg, struct qp_internal_byte_span* span, uint8_t max_bytes) {
     struct qp_internal_byte_input_state* state = (struct qp_internal_byte_input_state*)cb_arg;
 
     // Work out if we're parsing the initial marker byte
     if (state->rle.mode == MARKER_BYTE) {
-        uint8_t c = qp_stream_get(state->src_stream);
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return false;
+        }
+
         if (c >= 128) {
             state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
             state->rle.remain = c - 127;
         } else {
             state->rle.mode   = REPEATING_RUN; // repeated run
             state->rle.remain = c;
+
+            state->curr = qp_stream_get(state->src_stream);
+            if (c == 0 || state->curr < 0) {
+                return false;
+            }
         }
+    }
 
-        state->curr = qp_stream_get(state->src_stream);
+    // Hand over as much of the current run as was asked for
+    span->length = QP_MIN(state->rle.remain, max_bytes);
+    span->is_run = state->rle.mode == REPEATING_RUN;
+    if (span->is_run) {
+        span->bytes[0] = state->curr;
+    } else if (qp_stream_read(span->bytes, 1, span->length, state->src_stream) != span->length) {
+        return false;
     }
 
-    // Work out which byte we're returning
-    uint8_t c = state->curr;
+    // Swap back to querying the marker byte mode once the run is exhausted
+    state->rle.remain -= span->length;
+    if (state->rle.remain == 0) {
+        state->rle.mode = MARKER_BYTE;
+    }
 
-    // Decrement the counter of the bytes remaining
-    state->rle.remain--;
+    return true;
+}
 
-    if (state->rle.remain > 0) {
-        // If we're in a non-repeating run, queue up the next byte
-        if (state->rle.mode == NON_REPEATING_RUN) {
-            state->curr = qp_stream_get(state->src_stream);
+#if QUANTUM_PAINTER_SUPPORTS_LZ
+// The last bytes decoded, used as the source of back references. Decoding is never interleaved, so one is shared.
+static uint8_t qp_internal_lz_window[QP_INTERNAL_LZ_WINDOW_SIZE];
+
+static inline bool qp_drawimage_byte_lz_decoder(void* cb_arg, struct qp_internal_byte_span* span, uint8_t max_bytes) {
+    struct qp_internal_byte_input_state* state = (struct qp_internal_byte_input_state*)cb_arg;
+
+    // Work out if we're parsing the initial marker byte
+    if (state->lz.mode == MARKER_BYTE) {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return false;
+        }
+
+        if (c < 128) {
+            state->lz.mode   = NON_REPEATING_RUN; // literal bytes
+            state->lz.remain = c + 1;
+        } else {
+            state->lz.mode   = BACK_REFERENCE; // copy of earlier output
+            state->lz.remain = c - 125;
+
+            int16_t distance = qp_stream_get(state->src_stream);
+            if (distance < 0) {
+                return false;
+            }
+            state->lz.distance = distance;
+        }
+    }
+
+    // Hand over as much of the current run as was asked for, keeping a copy in the window
+    span->length = QP_MIN(state->lz.remain, max_bytes);
+    span->is_run = state->lz.mode == BACK_REFERENCE && state->lz.distance == 0;
+    if (state->lz.mode == NON_REPEATING_RUN) {
+        if (qp_stream_read(span->bytes, 1, span->length, state->src_stream) != span->length) {
+            return false;
+        }
+        for (uint8_t i = 0; i < span->length; ++i) {
+            qp_internal_lz_window[state->lz.write_pos++] = span->bytes[i];
+        }
+    } else if (span->is_run) {
+        // A back reference to the previous byte is a run of it
+        span->bytes[0] = qp_internal_lz_window[(uint8_t)(state->lz.write_pos - 1)];
+        for (uint8_t i = 0; i < span->length; ++i) {
+            qp_internal_lz_window[state->lz.write_pos++] = span->bytes[0];
         }
     } else {
-        // Swap back to querying the marker byte mode
-        state->rle.mode = MARKER_BYTE;
+        // Byte by byte, as the source may overlap what's being written
+        for (uint8_t i = 0; i < span->length; ++i) {
+            uint8_t c                                    = qp_internal_lz_window[(uint8_t)(state->lz.write_pos - state->lz.distance - 1)];
+            qp_internal_lz_window[state->lz.write_pos++] = c;
+            span->bytes[i]                               = c;
+        }
     }
 
-    return c;
-}
+    // Swap back to querying the marker byte mode once the run is exhausted
+    state->lz.remain -= span->length;
+    if (state->lz.remain == 0) {
+        state->lz.mode = MARKER_BYTE;
+    }
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
-    struct qp_internal_pixel_output_state* state  = (struct qp_internal_pixel_output_state*)cb_arg;
-    struct painter_driver_t*               driver = (struct painter_driver_t*)state->device;
+    return true;
+}
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
+// Converts palette indices into the pixdata buffer -- the caller ensures they fit
+static inline bool qp_internal_pixel_buffer_append(struct qp_internal_pixel_output_state* state, qp_pixel_t* palette, const uint8_t* indices, uint32_t count) {
+    struct painter_driver_t* driver = (struct painter_driver_t*)state->device;
+    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, count, (uint8_t*)indices)) {
         return false;
     }
+    state->pixel_write_pos += count;
+    return true;
+}
 
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
+// If we've hit the transmit limit, send out the entire buffer and reset the write position
+static inline bool qp_internal_pixel_buffer_send_if_full(struct qp_internal_pixel_output_state* state) {
     if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+        if (!qp_internal_send_pixdata_buffer(state->device, state->pixel_write_pos)) {
             return false;
         }
         state->pixel_write_pos = 0;
     }
+    return true;
+}
+
+static bool qp_internal_pixel_appender_fill(struct qp_internal_pixel_output_state* state, qp_pixel_t* palette, uint8_t index, uint32_t count) {
+    struct painter_driver_t* driver = (struct painter_driver_t*)state->device;
+    uint8_t                  indices[QP_INTERNAL_DECODE_CHUNK_PIXELS];
+    memset(indices, index, sizeof(indices));
+
+    while (count > 0) {
+        if (state->pixel_write_pos == 0 && count >= state->max_pixels) {
+            // Convert a whole buffer of the pixel once, then transmit it as many times as it fits in the fill
+            while (state->pixel_write_pos < state->max_pixels) {
+                if (!qp_internal_pixel_buffer_append(state, palette, indices, QP_MIN(state->max_pixels - state->pixel_write_pos, QP_INTERNAL_DECODE_CHUNK_PIXELS))) {
+                    return false;
+                }
+            }
+            for (uint32_t repeats = count / state->max_pixels; repeats > 1; --repeats) {
+                if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->max_pixels)) {
+                    return false;
+                }
+            }
+            count %= state->max_pixels;
+        } else {
+            uint32_t chunk_pixels = QP_MIN(QP_MIN(count, state->max_pixels - state->pixel_write_pos), QP_INTERNAL_DECODE_CHUNK_PIXELS);
+            if (!qp_internal_pixel_buffer_append(state, palette, indices, chunk_pixels)) {
+                return false;
+            }
+            count -= chunk_pixels;
+        }
+
+        if (!qp_internal_pixel_buffer_send_if_full(state)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool qp_internal_pixel_appender(qp_pixel_t* palette, const uint8_t* indices, uint32_t count, bool is_fill, void* cb_arg) {
+    struct qp_internal_pixel_output_state* state = (struct qp_internal_pixel_output_state*)cb_arg;
+
+    if (is_fill) {
+        return qp_internal_pixel_appender_fill(state, palette, indices[0], count);
+    }
+
+    while (count > 0) {
+        uint32_t chunk_pixels = QP_MIN(count, state->max_pixels - state->pixel_write_pos);
+        if (!qp_internal_pixel_buffer_append(state, palette, indices, chunk_pixels) || !qp_internal_pixel_buffer_send_if_full(state)) {
+            return false;
+        }
+        indices += chunk_pixels;
+        count -= chunk_pixels;
+    }
 
     return true;
 }
@@ -136,6 +305,13 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(struct qp_intern
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+#if QUANTUM_PAINTER_SUPPORTS_LZ
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.mode      = MARKER_BYTE;
+            input_state->lz.remain    = 0;
+            input_state->lz.write_pos = 0;
+            return qp_drawimage_byte_lz_decoder;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ
         default:
             return NULL;
     }
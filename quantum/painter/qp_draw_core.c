@@ -20,7 +20,13 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+// Two of them, so that one can be filled while the other is still being transmitted.
+__attribute__((__aligned__(4))) static uint8_t pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t *                                      qp_internal_global_pixdata_buffer = pixdata_buffers[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -41,6 +47,16 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+// Transmits the pixels in the global pixdata buffer. When double-buffered, switches to the other buffer afterwards, which is free to be refilled while this one is still being transmitted.
+bool qp_internal_send_pixdata_buffer(painter_device_t device, uint32_t native_pixel_count) {
+    struct painter_driver_t *driver = (struct painter_driver_t *)device;
+    bool                     ret    = driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == pixdata_buffers[0]) ? pixdata_buffers[1] : pixdata_buffers[0];
+#endif
+    return ret;
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     struct painter_driver_t *driver = (struct painter_driver_t *)device;
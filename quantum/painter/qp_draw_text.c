@@ -20,6 +20,8 @@ typedef struct qff_font_handle_t {
     uint8_t               bpp;
     bool                  has_palette;
     painter_compression_t compression_scheme;
+    uint32_t              unicode_table_offset; // stream position of the first unicode glyph
+    uint32_t              glyph_data_offset;    // stream position of the first byte of glyph data
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -35,6 +37,112 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+#if QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+typedef struct qp_glyph_cache_entry_t {
+    qff_font_handle_t *font; // NULL if the entry is unused
+    painter_device_t   device;
+    uint32_t           code_point;
+    uint32_t           data_offset;
+    uint32_t           last_used;
+    qp_pixel_t         fg_hsv888;
+    qp_pixel_t         bg_hsv888;
+    uint8_t            width;
+    uint8_t            pixels[QUANTUM_PAINTER_CACHED_GLYPH_SIZE]; // the rendered glyph, in the device's native format
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_NUM_CACHED_GLYPHS] = {0};
+static uint32_t               glyph_cache_counter                             = 0;
+
+// Finds a cached glyph, marking it as the most recently used. If device is NULL, any rendering of the glyph matches, which is enough for its metrics.
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(qff_font_handle_t *font, uint32_t code_point, painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_NUM_CACHED_GLYPHS; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font != font || entry->code_point != code_point) {
+            continue;
+        }
+        if (device && (entry->device != device || memcmp(&entry->fg_hsv888.hsv888, &fg_hsv888.hsv888, sizeof(fg_hsv888.hsv888)) != 0 || memcmp(&entry->bg_hsv888.hsv888, &bg_hsv888.hsv888, sizeof(bg_hsv888.hsv888)) != 0)) {
+            continue;
+        }
+        entry->last_used = ++glyph_cache_counter;
+        return entry;
+    }
+    return NULL;
+}
+
+// Frees up the least recently used entry
+static qp_glyph_cache_entry_t *qp_glyph_cache_evict(void) {
+    qp_glyph_cache_entry_t *oldest = &glyph_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_NUM_CACHED_GLYPHS && oldest->font; ++i) {
+        if (!glyph_cache[i].font || glyph_cache[i].last_used < oldest->last_used) {
+            oldest = &glyph_cache[i];
+        }
+    }
+    oldest->font = NULL;
+    return oldest;
+}
+
+// Drops all the glyphs of a font, as its handle may be reused for a different font
+static void qp_glyph_cache_invalidate_font(qff_font_handle_t *font) {
+    for (int i = 0; i < QUANTUM_PAINTER_NUM_CACHED_GLYPHS; ++i) {
+        if (glyph_cache[i].font == font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+// Transmits a cached glyph
+static bool qp_glyph_cache_send(painter_device_t device, const uint8_t *pixels, uint32_t pixel_count) {
+    struct painter_driver_t *driver = (struct painter_driver_t *)device;
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    // The cache entry may be replaced while it's still being transmitted, so go through the pixdata buffers instead
+    uint32_t max_pixels = qp_internal_num_pixels_in_buffer(device);
+    while (pixel_count > 0) {
+        uint32_t chunk_pixels = QP_MIN(pixel_count, max_pixels);
+        uint32_t chunk_bytes  = (chunk_pixels * driver->native_bits_per_pixel + 7) / 8;
+        memcpy(qp_internal_global_pixdata_buffer, pixels, chunk_bytes);
+        if (!qp_internal_send_pixdata_buffer(device, chunk_pixels)) {
+            return false;
+        }
+        pixels += chunk_bytes;
+        pixel_count -= chunk_pixels;
+    }
+    return true;
+#    else
+    return driver->driver_vtable->pixdata(device, pixels, pixel_count);
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+}
+
+// Output state and callback used to render glyphs into the cache
+struct qp_glyph_cache_output_state {
+    painter_device_t device;
+    uint8_t *        pixels;
+    uint32_t         pixel_write_pos;
+};
+
+static bool qp_glyph_cache_appender(qp_pixel_t *palette, const uint8_t *indices, uint32_t count, bool is_fill, void *cb_arg) {
+    struct qp_glyph_cache_output_state *state  = (struct qp_glyph_cache_output_state *)cb_arg;
+    struct painter_driver_t *           driver = (struct painter_driver_t *)state->device;
+
+    uint8_t fill_indices[QP_INTERNAL_DECODE_CHUNK_PIXELS];
+    if (is_fill) {
+        memset(fill_indices, indices[0], sizeof(fill_indices));
+    }
+
+    while (count > 0) {
+        uint32_t chunk_pixels = is_fill ? QP_MIN(count, QP_INTERNAL_DECODE_CHUNK_PIXELS) : count;
+        if (!driver->driver_vtable->append_pixels(state->device, state->pixels, palette, state->pixel_write_pos, chunk_pixels, (uint8_t *)(is_fill ? fill_indices : indices))) {
+            return false;
+        }
+        state->pixel_write_pos += chunk_pixels;
+        count -= chunk_pixels;
+    }
+    return true;
+}
+#endif // QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_load_font_mem
 
@@ -101,6 +209,20 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     // Read the info (parsing already successful above, no need to check return value)
     qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->bpp, &font->has_palette, &font->compression_scheme, NULL);
 
+    // Work out where the unicode glyphs and glyph data are located, as every glyph lookup is relative to them
+    uint32_t offset = sizeof(qff_font_descriptor_v1_t);
+    if (font->has_ascii_table) {
+        offset += sizeof(qff_ascii_glyph_table_v1_t);
+    }
+    font->unicode_table_offset = offset + sizeof(qgf_block_header_v1_t);
+    if (font->num_unicode_glyphs > 0) {
+        offset += sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t));
+    }
+    if (font->has_palette) {
+        offset += sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t));
+    }
+    font->glyph_data_offset = offset + sizeof(qgf_block_header_v1_t);
+
     if (!qp_internal_bpp_capable(font->bpp)) {
         qp_dprintf("qp_load_font_mem: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE)\n", (int)font->bpp);
         qp_close_font((painter_font_handle_t)font);
@@ -132,6 +254,10 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+
     // Free up this font for use elsewhere.
     qff_font->validate_ok = false;
     return true;
@@ -141,25 +267,19 @@ bool qp_close_font(painter_font_handle_t font) {
 // Helpers
 
 // Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, uint32_t data_offset, void *cb_arg);
 
-// Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
-static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
+// Helper that sets up the palette (if required)
+static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
     struct painter_driver_t *driver = (struct painter_driver_t *)device;
 
-    // Drop out if we can't actually place the data we read out anywhere
-    if (!data_offset) {
-        qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
-        return false;
-    }
-
-    // Work out where we're reading from
+    // Work out where the palette is located
     uint32_t offset = sizeof(qff_font_descriptor_v1_t);
     if (qff_font->has_ascii_table) {
         offset += sizeof(qff_ascii_glyph_table_v1_t);
     }
     if (qff_font->num_unicode_glyphs > 0) {
-        offset += sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * 6);
+        offset += sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t));
     }
 
     // Handle palette if needed
@@ -172,8 +292,6 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
             return false;
         }
 
-        // Skip this block, as far as offset calculations go
-        offset += sizeof(qgf_palette_v1_t) + (palette_entries * 3);
         needs_pixconvert = true;
     } else {
         // Interpolate from fg/bg
@@ -190,11 +308,22 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
         }
     }
 
-    *data_offset = offset;
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Looks up the width of a glyph, and the stream position of its pixel data
+static inline bool qp_drawtext_find_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+#if QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+    qp_pixel_t              no_color = {0};
+    qp_glyph_cache_entry_t *entry    = qp_glyph_cache_find(qff_font, code_point, NULL, no_color, no_color);
+    if (entry) {
+        *width       = entry->width;
+        *data_offset = entry->data_offset;
+        return true;
+    }
+#endif // QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+
+    uint32_t glyph_value;
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -211,65 +340,44 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + sizeof(qff_ascii_glyph_table_v1_t)                                                                                                                // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        glyph_value = glyph_info.value;
     } else {
-        // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+        // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified -- it's sorted by code point, so binary search it
+        qff_unicode_glyph_v1_t glyph_info;
+        uint16_t               lower = 0;
+        uint16_t               upper = qff_font->num_unicode_glyphs;
+        while (true) {
+            if (lower >= upper) {
+                qp_dprintf("Failed to find unicode glyph info\n");
+                return false;
+            }
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
+            uint16_t middle = lower + (upper - lower) / 2;
+            if (qp_stream_setpos(&qff_font->stream, qff_font->unicode_table_offset + middle * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while preparing glyph data\n");
+                return false;
+            }
 
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
             if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                 return false;
             }
 
             if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + sizeof(qff_ascii_glyph_table_v1_t)                                                                                                                // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
+                break;
+            } else if (glyph_info.code_point < code_point) {
+                lower = middle + 1;
+            } else {
+                upper = middle;
             }
         }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
-        return false;
+        glyph_value = glyph_info.value;
     }
-    return false;
+
+    *width       = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    *data_offset = qff_font->glyph_data_offset + ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    return true;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
@@ -282,13 +390,14 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
-            qp_dprintf("Failed to prepare glyph for rendering.\n");
+        uint8_t  width;
+        uint32_t data_offset;
+        if (!qp_drawtext_find_glyph(qff_font, code_point, &width, &data_offset)) {
+            qp_dprintf("Failed to find glyph.\n");
             return false;
         }
 
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, width, qff_font->base.line_height, data_offset, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -305,7 +414,7 @@ struct code_point_iter_calcwidth_state {
 };
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, uint32_t data_offset, void *cb_arg) {
     struct code_point_iter_calcwidth_state *state = (struct code_point_iter_calcwidth_state *)cb_arg;
 
     // Increment the overall width by this glyph's width
@@ -325,32 +434,83 @@ struct code_point_iter_drawglyph_state {
     qp_internal_byte_input_callback        input_callback;
     struct qp_internal_byte_input_state *  input_state;
     struct qp_internal_pixel_output_state *output_state;
+    qp_pixel_t                             fg_hsv888;
+    qp_pixel_t                             bg_hsv888;
 };
 
+#if QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+// Renders a glyph into the cache, returning NULL if it doesn't fit or can't be decoded
+static qp_glyph_cache_entry_t *qp_drawtext_cache_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, uint32_t data_offset, struct code_point_iter_drawglyph_state *state) {
+    struct painter_driver_t *driver      = (struct painter_driver_t *)state->device;
+    uint32_t                 pixel_count = ((uint32_t)width) * height;
+    if ((pixel_count * driver->native_bits_per_pixel + 7) / 8 > QUANTUM_PAINTER_CACHED_GLYPH_SIZE) {
+        return NULL;
+    }
+
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        return NULL;
+    }
+    qp_internal_prepare_input_state(state->input_state, qff_font->compression_scheme);
+
+    qp_glyph_cache_entry_t *           entry        = qp_glyph_cache_evict();
+    struct qp_glyph_cache_output_state output_state = {.device = state->device, .pixels = entry->pixels, .pixel_write_pos = 0};
+    if (!qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_glyph_cache_appender, &output_state)) {
+        return NULL;
+    }
+
+    // Only fill in the key once the pixels are valid
+    entry->font        = qff_font;
+    entry->device      = state->device;
+    entry->code_point  = code_point;
+    entry->data_offset = data_offset;
+    entry->last_used   = ++glyph_cache_counter;
+    entry->fg_hsv888   = state->fg_hsv888;
+    entry->bg_hsv888   = state->bg_hsv888;
+    entry->width       = width;
+    return entry;
+}
+#endif // QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, uint32_t data_offset, void *cb_arg) {
     struct code_point_iter_drawglyph_state *state  = (struct code_point_iter_drawglyph_state *)cb_arg;
     struct painter_driver_t *               driver = (struct painter_driver_t *)state->device;
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
-
-    // Reset the output state
-    state->output_state->pixel_write_pos = 0;
-
     // Configure where we're going to be rendering to
     driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
 
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph
     uint32_t pixel_count = ((uint32_t)width) * height;
-    bool     ret         = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
+
+#if QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+    // Reuse the glyph if it's already been rendered with these colors, otherwise try to keep it for next time
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(qff_font, code_point, state->device, state->fg_hsv888, state->bg_hsv888);
+    if (!entry) {
+        entry = qp_drawtext_cache_glyph(qff_font, code_point, width, height, data_offset, state);
+    }
+    if (entry) {
+        return qp_glyph_cache_send(state->device, entry->pixels, pixel_count);
+    }
+#endif // QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+
+    // Reset the input state, each glyph is compressed separately
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+    qp_internal_prepare_input_state(state->input_state, qff_font->compression_scheme);
+
+    // Reset the output state
+    state->output_state->pixel_write_pos = 0;
+
+    // Decode the pixel data for the glyph
+    bool ret = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
 
     // Any leftovers need transmission as well.
     if (ret && state->output_state->pixel_write_pos > 0) {
-        ret &= driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->output_state->pixel_write_pos);
+        ret &= qp_internal_send_pixdata_buffer(state->device, state->output_state->pixel_write_pos);
     }
 
     return ret;
@@ -416,7 +576,9 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     struct qp_internal_pixel_output_state output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
     // Set up the codepoint iteration state
-    struct code_point_iter_drawglyph_state state = {// Common
+    qp_pixel_t                             fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t                             bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    struct code_point_iter_drawglyph_state state     = {// Common
                                                     .device = device,
                                                     .xpos   = x,
                                                     .ypos   = y,
@@ -424,12 +586,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
                                                     .input_callback = input_callback,
                                                     .input_state    = &input_state,
                                                     // Output
-                                                    .output_state = &output_state};
+                                                    .output_state = &output_state,
+                                                    // Colors, for the glyph cache
+                                                    .fg_hsv888 = fg_hsv888,
+                                                    .bg_hsv888 = bg_hsv888};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
+    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
         return false;
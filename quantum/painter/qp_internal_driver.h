@@ -42,6 +42,9 @@ struct painter_comms_vtable_t {
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+
+    // Optional -- returns before the data has been sent, which must be left untouched until the next comms call
+    painter_driver_comms_send_func comms_send_async;
 };
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
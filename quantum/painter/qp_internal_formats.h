@@ -46,4 +46,4 @@ typedef enum qp_image_format_t {
     PALETTE_8BPP   = 0x07,
 } qp_image_format_t;
 
-typedef enum painter_compression_t { IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE } painter_compression_t;
+typedef enum painter_compression_t { IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ } painter_compression_t;
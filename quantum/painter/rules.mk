@@ -3,7 +3,7 @@ QUANTUM_PAINTER_DRIVERS ?=
 QUANTUM_PAINTER_ANIMATIONS_ENABLE ?= yes
 
 # The list of permissible drivers that can be listed in QUANTUM_PAINTER_DRIVERS
-VALID_QUANTUM_PAINTER_DRIVERS := ili9163_spi ili9341_spi st7789_spi gc9a01_spi ssd1351_spi
+VALID_QUANTUM_PAINTER_DRIVERS := ili9163_spi ili9341_spi st7789_spi gc9a01_spi ssd1351_spi surface
 
 #-------------------------------------------------------------------------------
 
@@ -13,6 +13,7 @@ SRC += \
     $(QUANTUM_DIR)/utf8.c \
     $(QUANTUM_DIR)/color.c \
     $(QUANTUM_DIR)/painter/qp.c \
+    $(QUANTUM_DIR)/painter/qp_comms.c \
     $(QUANTUM_DIR)/painter/qp_stream.c \
     $(QUANTUM_DIR)/painter/qgf.c \
     $(QUANTUM_DIR)/painter/qff.c \
@@ -31,6 +32,7 @@ endif
 
 # Comms flags
 QUANTUM_PAINTER_NEEDS_COMMS_SPI ?= no
+QUANTUM_PAINTER_NEEDS_COMMS_DUMMY ?= no
 
 # Handler for each driver
 define handle_quantum_painter_driver
@@ -94,6 +96,12 @@ define handle_quantum_painter_driver
             $(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
             $(DRIVER_PATH)/painter/ssd1351/qp_ssd1351.c
 
+    else ifeq ($$(strip $$(CURRENT_PAINTER_DRIVER)),surface)
+        QUANTUM_PAINTER_NEEDS_COMMS_DUMMY := yes
+        OPT_DEFS += -DQUANTUM_PAINTER_SURFACE_ENABLE
+        COMMON_VPATH += $(DRIVER_PATH)/painter/generic
+        SRC += $(DRIVER_PATH)/painter/generic/qp_surface.c
+
     endif
 endef
 
@@ -105,12 +113,16 @@ ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_COMMS_SPI)), yes)
     OPT_DEFS += -DQUANTUM_PAINTER_SPI_ENABLE
     QUANTUM_LIB_SRC += spi_master.c
     VPATH += $(DRIVER_PATH)/painter/comms
-    SRC += \
-        $(QUANTUM_DIR)/painter/qp_comms.c \
-        $(DRIVER_PATH)/painter/comms/qp_comms_spi.c
+    SRC += $(DRIVER_PATH)/painter/comms/qp_comms_spi.c
 
     ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_COMMS_SPI_DC_RESET)), yes)
         OPT_DEFS += -DQUANTUM_PAINTER_SPI_DC_RESET_ENABLE
     endif
 endif
 
+# If dummy comms is needed, set up the required files
+ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_COMMS_DUMMY)), yes)
+    OPT_DEFS += -DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE
+    VPATH += $(DRIVER_PATH)/painter/comms
+    SRC += $(DRIVER_PATH)/painter/comms/qp_comms_dummy.c
+endif
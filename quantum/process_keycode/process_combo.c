@@ -518,6 +518,79 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
     return key_is_part_of_combo;
 }
 
+#ifdef COMBO_KEYCODE_INDEX
+/* Keycode index of the combo table.
+ *
+ * Combos are grouped into hash buckets by their keycodes. A combo is listed once
+ * in every bucket one of its keys hashes to, in ascending combo index order, so
+ * a key event only has to visit the combos that may contain its keycode. The
+ * index is built on the first combo key event. If it does not fit into
+ * COMBO_KEYCODE_INDEX_SIZE entries, every key event scans the whole table. */
+#    ifndef COMBO_KEYCODE_INDEX_BUCKETS
+#        define COMBO_KEYCODE_INDEX_BUCKETS 32
+#    endif
+#    ifndef COMBO_KEYCODE_INDEX_SIZE
+#        define COMBO_KEYCODE_INDEX_SIZE 128
+#    endif
+#    if COMBO_KEYCODE_INDEX_BUCKETS > 32
+#        error "COMBO_KEYCODE_INDEX_BUCKETS must not be larger than 32"
+#    endif
+
+#    define COMBO_KEYCODE_INDEX_BUCKET(keycode) (((keycode) ^ ((keycode) >> 8)) % COMBO_KEYCODE_INDEX_BUCKETS)
+
+static uint16_t combo_index_bucket_start[COMBO_KEYCODE_INDEX_BUCKETS + 1];
+static uint16_t combo_index_entries[COMBO_KEYCODE_INDEX_SIZE];
+static bool     combo_index_built    = false;
+static bool     combo_index_overflow = false;
+
+/* Bit mask of the buckets the keys of the combo hash to. */
+static uint32_t combo_index_buckets(const combo_t *combo) {
+    uint32_t buckets = 0;
+    uint16_t key;
+    for (uint8_t i = 0; (key = pgm_read_word(&combo->keys[i])) != COMBO_END; ++i) {
+        buckets |= (uint32_t)1 << COMBO_KEYCODE_INDEX_BUCKET(key);
+    }
+    return buckets;
+}
+
+static void combo_index_build(void) {
+    uint16_t cursor[COMBO_KEYCODE_INDEX_BUCKETS] = {0};
+
+    /* count the entries of every bucket */
+    for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
+        uint32_t buckets = combo_index_buckets(&key_combos[idx]);
+        for (uint8_t bucket = 0; bucket < COMBO_KEYCODE_INDEX_BUCKETS; ++bucket) {
+            if (buckets & ((uint32_t)1 << bucket)) {
+                cursor[bucket]++;
+            }
+        }
+    }
+
+    combo_index_built           = true;
+    combo_index_bucket_start[0] = 0;
+    for (uint8_t bucket = 0; bucket < COMBO_KEYCODE_INDEX_BUCKETS; ++bucket) {
+        combo_index_bucket_start[bucket + 1] = combo_index_bucket_start[bucket] + cursor[bucket];
+        cursor[bucket]                       = combo_index_bucket_start[bucket];
+    }
+
+    combo_index_overflow = combo_index_bucket_start[COMBO_KEYCODE_INDEX_BUCKETS] > COMBO_KEYCODE_INDEX_SIZE;
+    if (combo_index_overflow) {
+        dprintf("combo: %u index entries needed, falling back to a full scan\n", combo_index_bucket_start[COMBO_KEYCODE_INDEX_BUCKETS]);
+        return;
+    }
+
+    /* fill the buckets in combo order */
+    for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
+        uint32_t buckets = combo_index_buckets(&key_combos[idx]);
+        for (uint8_t bucket = 0; bucket < COMBO_KEYCODE_INDEX_BUCKETS; ++bucket) {
+            if (buckets & ((uint32_t)1 << bucket)) {
+                combo_index_entries[cursor[bucket]++] = idx;
+            }
+        }
+    }
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
     bool is_combo_key          = false;
     bool no_combo_keys_pressed = true;
@@ -542,10 +615,26 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     keycode = keymap_key_to_keycode(COMBO_ONLY_FROM_LAYER, record->event.key);
 #endif
 
-    for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
-        combo_t *combo = &key_combos[idx];
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX
+    if (!combo_index_built) {
+        combo_index_build();
+    }
+
+    /* COMBO_END matches the terminator of every combo, so it takes the full scan. */
+    if (!combo_index_overflow && keycode != COMBO_END) {
+        uint8_t bucket = COMBO_KEYCODE_INDEX_BUCKET(keycode);
+        for (uint16_t i = combo_index_bucket_start[bucket]; i < combo_index_bucket_start[bucket + 1]; ++i) {
+            uint16_t idx = combo_index_entries[i];
+            is_combo_key |= process_single_combo(&key_combos[idx], keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
+            combo_t *combo = &key_combos[idx];
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
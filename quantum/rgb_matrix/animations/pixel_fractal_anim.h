@@ -35,6 +35,7 @@ static bool PIXEL_FRACTAL(effect_params_t* params) {
 
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
+        memset(led, 0, sizeof(led));
     }
 
     RGB rgb = rgb_matrix_hsv_to_rgb(rgb_matrix_config.hsv);
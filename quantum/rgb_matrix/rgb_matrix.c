@@ -35,6 +35,25 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Angle and distance of an LED from the center
+static inline led_polar_t rgb_matrix_led_polar(uint8_t i) {
+    int16_t     dx    = g_led_config.point[i].x - k_rgb_matrix_center.x;
+    int16_t     dy    = g_led_config.point[i].y - k_rgb_matrix_center.y;
+    led_polar_t polar = {.angle = atan2_8(dy, dx), .dist = sqrt16(dx * dx + dy * dy)};
+    return polar;
+}
+
+#ifdef RGB_MATRIX_POLAR_TABLE
+led_polar_t g_rgb_matrix_polar[DRIVER_LED_TOTAL];
+
+// Has to be called again whenever g_led_config.point is changed at runtime
+void rgb_matrix_update_polar_table(void) {
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        g_rgb_matrix_polar[i] = rgb_matrix_led_polar(i);
+    }
+}
+#endif
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -116,25 +135,6 @@ uint32_t     g_rgb_timer;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-last_hit_t g_last_hit_tracker;
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
-
-// internals
-static bool            suspend_state     = false;
-static uint8_t         rgb_last_enable   = UINT8_MAX;
-static uint8_t         rgb_last_effect   = UINT8_MAX;
-static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
-static rgb_task_states rgb_task_state    = SYNCING;
-#if RGB_DISABLE_TIMEOUT > 0
-static uint32_t rgb_anykey_timer;
-#endif // RGB_DISABLE_TIMEOUT > 0
-
-// double buffers
-static uint32_t rgb_timer_buffer;
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-static last_hit_t last_hit_buffer;
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // split rgb matrix
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
@@ -192,30 +192,63 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
+// rendering core
+#define LED_RENDER_CORE_NAME(name) rgb_##name
+#define LED_RENDER_CORE_PIXEL_TYPE RGB
+#define LED_RENDER_CORE_PIXEL_OFF ((RGB){.r = 0, .g = 0, .b = 0})
+#define LED_RENDER_CORE_DRIVER_SET(i, pixel) rgb_matrix_driver.set_color(i, (pixel).r, (pixel).g, (pixel).b)
+#define LED_RENDER_CORE_DRIVER_SET_ALL(pixel) rgb_matrix_driver.set_color_all((pixel).r, (pixel).g, (pixel).b)
+#define LED_RENDER_CORE_DRIVER_FLUSH() rgb_matrix_driver.flush()
+#define LED_RENDER_CORE_CONFIG rgb_matrix_config
+#define LED_RENDER_CORE_TIMER g_rgb_timer
+#define LED_RENDER_CORE_FLUSH_LIMIT RGB_MATRIX_LED_FLUSH_LIMIT
+#define LED_RENDER_CORE_DISABLE_TIMEOUT RGB_DISABLE_TIMEOUT
+#define LED_RENDER_CORE_SYNC() eeconfig_flush_rgb_matrix(false)
+#define LED_RENDER_CORE_INDICATORS(params)      \
+    do {                                        \
+        rgb_matrix_indicators();                \
+        rgb_matrix_indicators_advanced(params); \
+    } while (0)
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+#    define LED_RENDER_CORE_KEYREACTIVE
+#endif
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#    define LED_RENDER_CORE_SPLIT
+#endif
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+#    define LED_RENDER_CORE_RENDER_BUDGET_US RGB_MATRIX_RENDER_BUDGET_US
+#    define LED_RENDER_CORE_PROCESS_LIMIT g_rgb_matrix_led_process_limit
+#    define LED_RENDER_CORE_RENDER_STATS_TYPE rgb_matrix_render_stats_t
+#endif
+#include "led_render_core.inc"
+
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void) {
+    return rgb_get_render_stats();
+}
+
+void rgb_matrix_clear_render_stats(void) {
+    rgb_clear_render_stats();
+}
+#endif
+
 void rgb_matrix_update_pwm_buffers(void) {
-    rgb_matrix_driver.flush();
+    rgb_flush_pixels();
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    rgb_matrix_driver.set_color(index, red, green, blue);
+    rgb_set_pixel(index, (RGB){.r = red, .g = green, .b = blue});
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
-    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++)
-        rgb_matrix_set_color(i, red, green, blue);
-#else
-    rgb_matrix_driver.set_color_all(red, green, blue);
-#endif
+    rgb_set_pixel_all((RGB){.r = red, .g = green, .b = blue});
 }
 
 void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
 #endif
-#if RGB_DISABLE_TIMEOUT > 0
-    rgb_anykey_timer = 0;
-#endif // RGB_DISABLE_TIMEOUT > 0
+    rgb_task_keypress();
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     uint8_t led[LED_HITS_TO_REMEMBER];
@@ -230,22 +263,7 @@ void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
-    for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
-    }
+    rgb_last_hit_add(led, led_count);
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 #if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
@@ -288,59 +306,9 @@ static bool rgb_matrix_none(effect_params_t *params) {
     return false;
 }
 
-static void rgb_task_timers(void) {
-#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) || RGB_DISABLE_TIMEOUT > 0
-    uint32_t deltaTime = sync_timer_elapsed32(rgb_timer_buffer);
-#endif // defined(RGB_MATRIX_KEYREACTIVE_ENABLED) || RGB_DISABLE_TIMEOUT > 0
-    rgb_timer_buffer = sync_timer_read32();
-
-    // Update double buffer timers
-#if RGB_DISABLE_TIMEOUT > 0
-    if (rgb_anykey_timer + deltaTime <= UINT32_MAX) {
-        rgb_anykey_timer += deltaTime;
-    }
-#endif // RGB_DISABLE_TIMEOUT > 0
-
-    // Update double buffer last hit timers
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
-    }
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
-}
-
-static void rgb_task_sync(void) {
-    eeconfig_flush_rgb_matrix(false);
-    // next task
-    if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
-}
-
-static void rgb_task_start(void) {
-    // reset iter
-    rgb_effect_params.iter = 0;
-
-    // update double buffers
-    g_rgb_timer = rgb_timer_buffer;
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
-
-    // next task
-    rgb_task_state = RENDERING;
-}
-
 static void rgb_task_render(uint8_t effect) {
-    bool rendering         = false;
-    rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
-    if (rgb_effect_params.flags != rgb_matrix_config.flags) {
-        rgb_effect_params.flags = rgb_matrix_config.flags;
-        rgb_matrix_set_color_all(0, 0, 0);
-    }
+    bool rendering = false;
+    rgb_task_render_begin(effect);
 
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
@@ -382,61 +350,11 @@ static void rgb_task_render(uint8_t effect) {
             return;
     }
 
-    rgb_effect_params.iter++;
-
-    // next task
-    if (!rendering) {
-        rgb_task_state = FLUSHING;
-        if (!rgb_effect_params.init && effect == RGB_MATRIX_NONE) {
-            // We only need to flush once if we are RGB_MATRIX_NONE
-            rgb_task_state = SYNCING;
-        }
-    }
-}
-
-static void rgb_task_flush(uint8_t effect) {
-    // update last trackers after the first full render so we can init over several frames
-    rgb_last_effect = effect;
-    rgb_last_enable = rgb_matrix_config.enable;
-
-    // update pwm buffers
-    rgb_matrix_update_pwm_buffers();
-
-    // next task
-    rgb_task_state = SYNCING;
+    rgb_task_render_end(effect, rendering);
 }
 
 void rgb_matrix_task(void) {
-    rgb_task_timers();
-
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
-    bool suspend_backlight = suspend_state ||
-#if RGB_DISABLE_TIMEOUT > 0
-                             (rgb_anykey_timer > (uint32_t)RGB_DISABLE_TIMEOUT) ||
-#endif // RGB_DISABLE_TIMEOUT > 0
-                             false;
-
-    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
-
-    switch (rgb_task_state) {
-        case STARTING:
-            rgb_task_start();
-            break;
-        case RENDERING:
-            rgb_task_render(effect);
-            if (effect) {
-                rgb_matrix_indicators();
-                rgb_matrix_indicators_advanced(&rgb_effect_params);
-            }
-            break;
-        case FLUSHING:
-            rgb_task_flush(effect);
-            break;
-        case SYNCING:
-            rgb_task_sync();
-            break;
-    }
+    rgb_task_run();
 }
 
 void rgb_matrix_indicators(void) {
@@ -454,7 +372,7 @@ void rgb_matrix_indicators_advanced(effect_params_t *params) {
      * and not sure which would be better. Otherwise, this should be called from
      * rgb_task_render, right before the iter++ line.
      */
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#if defined(RGB_MATRIX_PROCESS_IN_CHUNKS)
     uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * (params->iter - 1);
     uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (max > DRIVER_LED_TOTAL) max = DRIVER_LED_TOTAL;
@@ -473,16 +391,12 @@ __attribute__((weak)) void rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        g_last_hit_tracker.tick[i] = UINT16_MAX;
-    }
+#ifdef RGB_MATRIX_POLAR_TABLE
+    rgb_matrix_update_polar_table();
+#endif
 
-    last_hit_buffer.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        last_hit_buffer.tick[i] = UINT16_MAX;
-    }
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+    rgb_last_hit_init();
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     if (!eeconfig_is_enabled()) {
@@ -46,11 +46,22 @@
 #    define RGB_MATRIX_LED_FLUSH_LIMIT 16
 #endif
 
-#ifndef RGB_MATRIX_LED_PROCESS_LIMIT
-#    define RGB_MATRIX_LED_PROCESS_LIMIT (DRIVER_LED_TOTAL + 4) / 5
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+// The number of LEDs rendered per task run is picked for every frame, so that
+// a render iteration stays within the budget. See led_render_core.inc.
+#    undef RGB_MATRIX_LED_PROCESS_LIMIT
+#    define RGB_MATRIX_LED_PROCESS_LIMIT g_rgb_matrix_led_process_limit
+#    define RGB_MATRIX_PROCESS_IN_CHUNKS
+#else
+#    ifndef RGB_MATRIX_LED_PROCESS_LIMIT
+#        define RGB_MATRIX_LED_PROCESS_LIMIT (DRIVER_LED_TOTAL + 4) / 5
+#    endif
+#    if RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#        define RGB_MATRIX_PROCESS_IN_CHUNKS
+#    endif
 #endif
 
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#if defined(RGB_MATRIX_PROCESS_IN_CHUNKS)
 #    if defined(RGB_MATRIX_SPLIT)
 #        define RGB_MATRIX_USE_LIMITS(min, max)                                                   \
             uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter;                            \
@@ -80,6 +91,11 @@
 #    endif
 #endif
 
+// The polar coordinates of every LED are computed once, if any effect needs them
+#if !defined(RGB_MATRIX_DISABLE_POLAR_TABLE) && (defined(ENABLE_RGB_MATRIX_CYCLE_OUT_IN) || defined(ENABLE_RGB_MATRIX_CYCLE_PINWHEEL) || defined(ENABLE_RGB_MATRIX_CYCLE_SPIRAL) || defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_SAT) || defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_VAL) || defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_SAT) || defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_VAL))
+#    define RGB_MATRIX_POLAR_TABLE
+#endif
+
 #define RGB_MATRIX_INDICATOR_SET_COLOR(i, r, g, b) \
     if (i >= led_min && i <= led_max) {            \
         rgb_matrix_set_color(i, r, g, b);          \
@@ -137,6 +153,9 @@ void rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 void rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
+#ifdef RGB_MATRIX_POLAR_TABLE
+void rgb_matrix_update_polar_table(void);
+#endif
 
 void rgb_matrix_reload_from_eeprom(void);
 
@@ -184,6 +203,18 @@ void        rgb_matrix_decrease_speed_noeeprom(void);
 led_flags_t rgb_matrix_get_flags(void);
 void        rgb_matrix_set_flags(led_flags_t flags);
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+typedef struct {
+    uint16_t fps;               // frames flushed per second, updated every second
+    uint16_t last_render_us;    // duration of the last render iteration
+    uint32_t overruns;          // render iterations that took longer than RGB_MATRIX_RENDER_BUDGET_US
+    uint8_t  led_process_limit; // LEDs rendered per iteration in the current frame
+} rgb_matrix_render_stats_t;
+
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void);
+void                      rgb_matrix_clear_render_stats(void);
+#endif
+
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_update_rgb_matrix
 #    define rgblight_reload_from_eeprom rgb_matrix_reload_from_eeprom
@@ -257,6 +288,12 @@ extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+extern uint8_t g_rgb_matrix_led_process_limit;
+#endif
+#ifdef RGB_MATRIX_POLAR_TABLE
+extern led_polar_t g_rgb_matrix_polar[DRIVER_LED_TOTAL];
+#endif
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
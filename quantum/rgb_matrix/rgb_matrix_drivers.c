@@ -25,6 +25,7 @@
 
 #if defined(IS31FL3731) || defined(IS31FL3733) || defined(IS31FL3737) || defined(IS31FL3741) || defined(IS31FLCOMMON) || defined(CKLED2001)
 #    include "i2c_master.h"
+#    include "led_flush.h"
 
 // TODO: Remove this at some later date
 #    if defined(DRIVER_ADDR_1) && defined(DRIVER_ADDR_2)
@@ -211,6 +212,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 
 #    elif defined(IS31FL3733)
 static void flush(void) {
+    if (led_flush_deferred()) {
+        return;
+    }
     IS31FL3733_update_pwm_buffers(DRIVER_ADDR_1, 0);
 #        if defined(DRIVER_ADDR_2)
     IS31FL3733_update_pwm_buffers(DRIVER_ADDR_2, 1);
@@ -232,6 +236,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 
 #    elif defined(IS31FL3737)
 static void flush(void) {
+    if (led_flush_deferred()) {
+        return;
+    }
     IS31FL3737_update_pwm_buffers(DRIVER_ADDR_1, 0);
 #        if defined(DRIVER_ADDR_2)
     IS31FL3737_update_pwm_buffers(DRIVER_ADDR_2, 1);
@@ -247,6 +254,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 
 #    elif defined(IS31FL3741)
 static void flush(void) {
+    if (led_flush_deferred()) {
+        return;
+    }
     IS31FL3741_update_pwm_buffers(DRIVER_ADDR_1, 0);
 #        if defined(DRIVER_ADDR_2)
     IS31FL3741_update_pwm_buffers(DRIVER_ADDR_2, 1);
@@ -283,6 +293,9 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 
 #    elif defined(CKLED2001)
 static void flush(void) {
+    if (led_flush_deferred()) {
+        return;
+    }
     CKLED2001_update_pwm_buffers(DRIVER_ADDR_1, 0);
 #        if defined(DRIVER_ADDR_2)
     CKLED2001_update_pwm_buffers(DRIVER_ADDR_2, 1);
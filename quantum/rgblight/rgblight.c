@@ -762,6 +762,7 @@ bool rgblight_get_layer_state(uint8_t layer) {
     return (rgblight_status.enabled_layer_mask & mask) != 0;
 }
 
+#    ifndef RGBLIGHT_CUSTOM_DRIVER
 // Write any enabled LED layers into the buffer
 static void rgblight_layers_write(void) {
 #    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
@@ -797,6 +798,7 @@ static void rgblight_layers_write(void) {
         }
     }
 }
+#    endif
 
 #    ifdef RGBLIGHT_LAYER_BLINK
 rgblight_layer_mask_t _blinking_layer_mask = 0;
@@ -1048,7 +1050,39 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
     **/
 }
 
+// Earliest sync timer value at which the animation steps or a blinking layer toggles. Returns false if neither is
+// running.
+static bool rgblight_next_deadline(uint16_t *deadline) {
+    bool scheduled = false;
+    if (rgblight_status.timer_enabled) {
+        // A restarted animation steps right away
+        *deadline = animation_status.restart ? sync_timer_read() : animation_status.last_timer;
+        scheduled = true;
+    }
+#    ifdef RGBLIGHT_LAYER_BLINK
+    if (_blinking_layer_mask != 0 && (!scheduled || timer_expired(*deadline, _repeat_timer))) {
+        *deadline = _repeat_timer;
+        scheduled = true;
+    }
+#    endif
+    return scheduled;
+}
+
+uint32_t rgblight_task_idle_time(void) {
+    uint16_t deadline;
+    if (!rgblight_next_deadline(&deadline)) {
+        return UINT32_MAX;
+    }
+    uint16_t now = sync_timer_read();
+    return timer_expired(now, deadline) ? 0 : (uint16_t)(deadline - now);
+}
+
 void rgblight_task(void) {
+    uint16_t deadline;
+    if (!rgblight_next_deadline(&deadline) || !timer_expired(sync_timer_read(), deadline)) {
+        return;
+    }
+
     if (rgblight_status.timer_enabled) {
         effect_func_t effect_func   = rgblight_effect_dummy;
         uint16_t      interval_time = 2000; // dummy interval
@@ -403,8 +403,12 @@ void rgblight_timer_init(void);
 void rgblight_timer_enable(void);
 void rgblight_timer_disable(void);
 void rgblight_timer_toggle(void);
+
+// Milliseconds until rgblight_task() has work to do, 0 if it is due, UINT32_MAX if no animation or blink is running
+uint32_t rgblight_task_idle_time(void);
 #else
 #    define rgblight_task()
+#    define rgblight_task_idle_time() UINT32_MAX
 #    define rgblight_timer_init()
 #    define rgblight_timer_enable()
 #    define rgblight_timer_disable()
@@ -0,0 +1,27 @@
+SPLIT_TRANSPORT_COMMON_DEFS := -DSPLIT_KEYBOARD -DSPLIT_COMMON_TRANSACTIONS -DCRC_ENABLE -DNO_DEBUG
+SPLIT_TRANSPORT_COMMON_INC := $(QUANTUM_PATH)/split_common $(QUANTUM_PATH)/split_common/tests
+SPLIT_TRANSPORT_COMMON_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+
+SPLIT_TRANSPORT_COMMON_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/tests/serial_loopback.c \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_tests.cpp
+
+split_transport_poll_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS)
+split_transport_poll_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_poll_CONFIG := $(SPLIT_TRANSPORT_COMMON_CONFIG)
+split_transport_poll_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
+
+split_transport_frame_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) -DSPLIT_TRANSPORT_FRAME
+split_transport_frame_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_frame_CONFIG := $(SPLIT_TRANSPORT_COMMON_CONFIG)
+split_transport_frame_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
+
+split_transport_notify_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) -DSPLIT_TRANSPORT_NOTIFY
+split_transport_notify_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_notify_CONFIG := $(SPLIT_TRANSPORT_COMMON_CONFIG)
+split_transport_notify_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
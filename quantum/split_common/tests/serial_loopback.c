@@ -0,0 +1,134 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "serial.h"
+#include "transactions.h"
+#include "serial_loopback.h"
+
+loopback_stats_t loopback_stats;
+
+static split_shared_memory_t other_half_memory;
+static loopback_half_t       current_half = LOOPBACK_MASTER;
+static bool                  connected    = true;
+static bool                  corrupt_next = false;
+
+// The wire from the slave to the master only ever holds the latest pushed buffer
+static struct {
+    bool    pending;
+    int     sstd_index;
+    uint8_t buffer[sizeof(split_shared_memory_t)];
+} pushed;
+static bool notification_received = false;
+
+void loopback_reset(void) {
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&other_half_memory, 0, sizeof(other_half_memory));
+    memset(&loopback_stats, 0, sizeof(loopback_stats));
+    memset(&pushed, 0, sizeof(pushed));
+    current_half          = LOOPBACK_MASTER;
+    connected             = true;
+    corrupt_next          = false;
+    notification_received = false;
+}
+
+void loopback_select_half(loopback_half_t half) {
+    if (half != current_half) {
+        split_shared_memory_t temp;
+        memcpy(&temp, split_shmem, sizeof(temp));
+        memcpy(split_shmem, &other_half_memory, sizeof(temp));
+        memcpy(&other_half_memory, &temp, sizeof(temp));
+        current_half = half;
+    }
+}
+
+loopback_half_t loopback_current_half(void) {
+    return current_half;
+}
+
+void loopback_set_connected(bool value) {
+    connected = value;
+}
+
+void loopback_corrupt_next_notification(void) {
+    corrupt_next = true;
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+// Master half: hand a pushed buffer over as the driver does when draining its receive queue
+static void receive_pushed(void) {
+    if (pushed.pending) {
+        split_transaction_desc_t *trans = &split_transaction_table[pushed.sstd_index];
+        memcpy(split_trans_target2initiator_buffer(trans), pushed.buffer, trans->target2initiator_buffer_size);
+        pushed.pending        = false;
+        notification_received = true;
+    }
+}
+
+bool soft_serial_transaction(int sstd_index) {
+    loopback_stats.transactions++;
+    receive_pushed();
+    if (!connected || sstd_index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    loopback_stats.bytes += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+
+    // Send the transaction buffer to the slave's copy of the shared memory
+    memcpy(((uint8_t *)&other_half_memory) + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+
+    loopback_select_half(LOOPBACK_SLAVE);
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    loopback_select_half(LOOPBACK_MASTER);
+
+    // Receive the transaction buffer from the slave's copy of the shared memory
+    memcpy(split_trans_target2initiator_buffer(trans), ((uint8_t *)&other_half_memory) + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    return true;
+}
+
+#ifdef SPLIT_TRANSPORT_NOTIFY
+bool soft_serial_target_notify(int sstd_index) {
+    if (!connected || sstd_index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    memcpy(pushed.buffer, split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+    if (corrupt_next) {
+        pushed.buffer[trans->target2initiator_buffer_size - 1] ^= 1;
+        corrupt_next = false;
+    }
+    pushed.pending    = true;
+    pushed.sstd_index = sstd_index;
+    loopback_stats.notifications++;
+    loopback_stats.bytes += 2 + trans->target2initiator_buffer_size;
+    return true;
+}
+
+bool soft_serial_initiator_receive_notifications(void) {
+    receive_pushed();
+    bool received         = notification_received;
+    notification_received = false;
+    return received;
+}
+#endif // SPLIT_TRANSPORT_NOTIFY
@@ -0,0 +1,49 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+Serial driver connecting both halves of a split keyboard within one process.
+
+The halves share a single split_shmem, so each keeps its own copy of the shared
+memory, and the harness swaps the copies whenever it switches halves. The
+master half is selected by default; the slave half runs its transaction
+callbacks within soft_serial_transaction(), and runs its scan between
+loopback_select_half(LOOPBACK_SLAVE) and loopback_select_half(LOOPBACK_MASTER).
+*/
+
+typedef enum { LOOPBACK_MASTER, LOOPBACK_SLAVE } loopback_half_t;
+
+typedef struct {
+    uint32_t transactions;  // transactions started by the master, including failed ones
+    uint32_t notifications; // buffers pushed by the slave
+    uint32_t bytes;         // bytes on the wire, in both directions
+} loopback_stats_t;
+
+void            loopback_reset(void);
+void            loopback_select_half(loopback_half_t half);
+loopback_half_t loopback_current_half(void);
+
+// While disconnected, transactions and pushes fail
+void loopback_set_connected(bool connected);
+// Flip a bit in the next buffer pushed by the slave
+void loopback_corrupt_next_notification(void);
+
+extern loopback_stats_t loopback_stats;
@@ -0,0 +1,202 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include <string.h>
+
+extern "C" {
+#include "transport.h"
+#include "serial_loopback.h"
+#include "timer.h"
+
+// transactions.h pulls in C-only static assertions
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+void advance_time(uint32_t ms);
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+bool is_keyboard_master(void) {
+    return loopback_current_half() == LOOPBACK_MASTER;
+}
+
+bool is_keyboard_left(void) {
+    return is_keyboard_master();
+}
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+class SplitTransport : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        loopback_reset();
+        memset(master_keys, 0, sizeof(master_keys));
+        memset(slave_keys, 0, sizeof(slave_keys));
+        memset(slave_matrix, 0, sizeof(slave_matrix));
+        memset(mirrored_matrix, 0, sizeof(mirrored_matrix));
+
+        // Let every forced sync come due, and bring both halves in sync
+        advance_time(1000);
+        scan();
+        memset(&loopback_stats, 0, sizeof(loopback_stats));
+    }
+
+    void slave_scan() {
+        loopback_select_half(LOOPBACK_SLAVE);
+        transactions_slave(mirrored_matrix, slave_keys);
+        loopback_select_half(LOOPBACK_MASTER);
+    }
+
+    bool master_scan() {
+        return transactions_master(master_keys, slave_matrix);
+    }
+
+    // One scan of both halves, 1ms apart from the previous one
+    bool scan() {
+        advance_time(1);
+        slave_scan();
+        bool okay = master_scan();
+        slave_scan();
+        return okay;
+    }
+
+    matrix_row_t master_keys[ROWS_PER_HAND];
+    matrix_row_t slave_keys[ROWS_PER_HAND];
+    matrix_row_t slave_matrix[ROWS_PER_HAND];
+    matrix_row_t mirrored_matrix[ROWS_PER_HAND];
+};
+
+TEST_F(SplitTransport, SlaveKeyPressReachesMaster) {
+    slave_keys[1] = 1 << 3;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 0);
+    EXPECT_EQ(slave_matrix[1], 1 << 3);
+
+    slave_keys[1] = 0;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[1], 0);
+}
+
+TEST_F(SplitTransport, MasterMatrixIsMirrored) {
+    master_keys[0] = 1 << 5;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(mirrored_matrix[0], 1 << 5);
+
+    master_keys[0] = 0;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(mirrored_matrix[0], 0);
+}
+
+TEST_F(SplitTransport, KeyPressTransfers) {
+    slave_keys[0] = 1;
+    advance_time(1);
+    slave_scan();
+    EXPECT_TRUE(master_scan());
+    EXPECT_EQ(slave_matrix[0], 1);
+
+#if defined(SPLIT_TRANSPORT_FRAME)
+    // The whole exchange is a single transaction
+    EXPECT_EQ(loopback_stats.transactions, 1);
+#elif defined(SPLIT_TRANSPORT_NOTIFY)
+    // The slave pushes the change, the master does not start any transaction
+    EXPECT_EQ(loopback_stats.transactions, 0);
+    EXPECT_EQ(loopback_stats.notifications, 1);
+#else
+    // Checksum, then data
+    EXPECT_EQ(loopback_stats.transactions, 2);
+#endif
+}
+
+TEST_F(SplitTransport, IdleTraffic) {
+    const uint32_t duration = 1000;
+    for (uint32_t i = 0; i < duration; i++) {
+        EXPECT_TRUE(scan());
+    }
+
+#if defined(SPLIT_TRANSPORT_FRAME)
+    EXPECT_EQ(loopback_stats.transactions, duration);
+#elif defined(SPLIT_TRANSPORT_NOTIFY)
+    // Only the forced syncs of the sync timer and mirrored matrix, and the liveness poll
+    EXPECT_LE(loopback_stats.transactions, 3 * (duration / FORCED_SYNC_THROTTLE_MS + 1));
+    EXPECT_EQ(loopback_stats.notifications, 0);
+#else
+    EXPECT_GE(loopback_stats.transactions, duration);
+#endif
+}
+
+TEST_F(SplitTransport, LostLinkIsDetected) {
+    loopback_set_connected(false);
+
+    bool failed = false;
+    for (uint32_t i = 0; i <= FORCED_SYNC_THROTTLE_MS && !failed; i++) {
+        failed = !scan();
+    }
+    EXPECT_TRUE(failed);
+
+    loopback_set_connected(true);
+    slave_keys[0] = 1 << 7;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 1 << 7);
+}
+
+#ifdef SPLIT_TRANSPORT_FRAME
+TEST_F(SplitTransport, FrameOnlyCarriesChanges) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_shmem->frame_m2s.length, 0);
+
+    master_keys[1] = 1 << 2;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_shmem->frame_m2s.length, sizeof(split_shmem->mmatrix.matrix));
+    EXPECT_EQ(mirrored_matrix[1], 1 << 2);
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_shmem->frame_m2s.length, 0);
+}
+
+TEST_F(SplitTransport, FrameIsResentInFullPeriodically) {
+    advance_time(FORCED_SYNC_THROTTLE_MS);
+    EXPECT_TRUE(scan());
+    // Every section of this configuration, i.e. the mirrored matrix and the sync timer
+    EXPECT_EQ(split_shmem->frame_m2s.length, sizeof(split_shmem->mmatrix.matrix) + sizeof(split_shmem->sync_timer));
+}
+#endif // SPLIT_TRANSPORT_FRAME
+
+#ifdef SPLIT_TRANSPORT_NOTIFY
+TEST_F(SplitTransport, CorruptNotificationFallsBackToPoll) {
+    loopback_corrupt_next_notification();
+    slave_keys[0] = 1 << 4;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[0], 1 << 4);
+    EXPECT_EQ(loopback_stats.notifications, 1);
+    EXPECT_EQ(loopback_stats.transactions, 1);
+}
+
+TEST_F(SplitTransport, FailedPushIsRetried) {
+    loopback_set_connected(false);
+    slave_keys[1] = 1 << 6;
+    slave_scan();
+    EXPECT_EQ(loopback_stats.notifications, 0);
+
+    loopback_set_connected(true);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_matrix[1], 1 << 6);
+    EXPECT_EQ(loopback_stats.notifications, 1);
+}
+#endif // SPLIT_TRANSPORT_NOTIFY
@@ -0,0 +1,4 @@
+TEST_LIST += \
+	split_transport_poll \
+	split_transport_frame \
+	split_transport_notify
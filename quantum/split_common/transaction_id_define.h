@@ -24,6 +24,14 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_TRANSPORT_FRAME
+    EXCHANGE_SPLIT_FRAME,
+#endif // SPLIT_TRANSPORT_FRAME
+
+#ifdef SPLIT_TRANSPORT_NOTIFY
+    GET_SLAVE_NOTIFY,
+#endif // SPLIT_TRANSPORT_NOTIFY
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -117,6 +117,8 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+// The per-feature master handlers are only compiled in when they aren't superseded by the combined frame or the slave notifications
+#if !defined(SPLIT_TRANSPORT_FRAME) && !defined(SPLIT_TRANSPORT_NOTIFY)
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -131,6 +133,7 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
     return okay;
 }
+#endif // !defined(SPLIT_TRANSPORT_FRAME) && !defined(SPLIT_TRANSPORT_NOTIFY)
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
@@ -150,10 +153,12 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 
 #ifdef SPLIT_TRANSPORT_MIRROR
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool master_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
     return send_if_data_mismatch(PUT_MASTER_MATRIX, &last_update, master_matrix, split_shmem->mmatrix.matrix, sizeof(split_shmem->mmatrix.matrix));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     // Always copy to the master matrix
@@ -177,6 +182,7 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 
 #ifdef ENCODER_ENABLE
 
+#    if !defined(SPLIT_TRANSPORT_FRAME) && !defined(SPLIT_TRANSPORT_NOTIFY)
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
     uint8_t         temp_state[NUM_ENCODERS_MAX_PER_SIDE];
@@ -185,6 +191,7 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
     if (okay) encoder_update_raw(temp_state);
     return okay;
 }
+#    endif // !defined(SPLIT_TRANSPORT_FRAME) && !defined(SPLIT_TRANSPORT_NOTIFY)
 
 static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     uint8_t encoder_state[NUM_ENCODERS_MAX_PER_SIDE];
@@ -216,6 +223,7 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 
 #ifndef DISABLE_SYNC_TIMER
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
 
@@ -229,6 +237,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     }
     return okay;
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_sync_timer = 0;
@@ -255,6 +264,7 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_layer_state_update         = 0;
     static uint32_t last_default_layer_state_update = 0;
@@ -265,6 +275,7 @@ static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row
     }
     return okay;
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     layer_state         = split_shmem->layers.layer_state;
@@ -292,11 +303,13 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #ifdef SPLIT_LED_STATE_ENABLE
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool led_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
     uint8_t         led_state   = host_keyboard_leds();
     return send_if_data_mismatch(PUT_LED_STATE, &last_update, &led_state, &split_shmem->led_state, sizeof(led_state));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     void set_split_host_keyboard_leds(uint8_t led_state);
@@ -320,6 +333,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #ifdef SPLIT_MODS_ENABLE
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
     bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
@@ -351,6 +365,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     return okay;
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     set_mods(split_shmem->mods.real_mods);
@@ -377,11 +392,13 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 
 #ifdef BACKLIGHT_ENABLE
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool backlight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
     uint8_t         level       = is_backlight_enabled() ? get_backlight_level() : 0;
     return send_if_condition(PUT_BACKLIGHT, &last_update, (level != split_shmem->backlight_level), &level, sizeof(level));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     backlight_set(split_shmem->backlight_level);
@@ -404,6 +421,7 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update = 0;
     rgblight_syncinfo_t rgblight_sync;
@@ -415,6 +433,7 @@ static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     }
     return true;
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     // Update the RGB with the new data
@@ -441,6 +460,7 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update = 0;
     led_matrix_sync_t led_matrix_sync;
@@ -448,6 +468,7 @@ static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
     return send_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(&led_matrix_eeconfig, &split_shmem->led_matrix_sync.led_matrix, sizeof(led_eeconfig_t));
@@ -471,6 +492,7 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update = 0;
     rgb_matrix_sync_t rgb_matrix_sync;
@@ -478,6 +500,7 @@ static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
     return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(&rgb_matrix_config, &split_shmem->rgb_matrix_sync.rgb_matrix, sizeof(rgb_config_t));
@@ -501,11 +524,13 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool wpm_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
     uint8_t         current_wpm = get_current_wpm();
     return send_if_condition(PUT_WPM, &last_update, (current_wpm != split_shmem->current_wpm), &current_wpm, sizeof(current_wpm));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     set_current_wpm(split_shmem->current_wpm);
@@ -528,11 +553,13 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool oled_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update        = 0;
     bool            current_oled_state = is_oled_on();
     return send_if_condition(PUT_OLED, &last_update, (current_oled_state != split_shmem->current_oled_state), &current_oled_state, sizeof(current_oled_state));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     if (split_shmem->current_oled_state) {
@@ -559,11 +586,13 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool st7565_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update          = 0;
     bool            current_st7565_state = st7565_is_on();
     return send_if_condition(PUT_ST7565, &last_update, (current_st7565_state != split_shmem->current_st7565_state), &current_st7565_state, sizeof(current_st7565_state));
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     if (split_shmem->current_st7565_state) {
@@ -590,6 +619,7 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
+#    ifndef SPLIT_TRANSPORT_FRAME
 static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #    if defined(POINTING_DEVICE_LEFT)
     if (is_keyboard_left()) {
@@ -600,12 +630,17 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
+    static uint16_t last_cpi = 0;
+    uint16_t        temp_cpi;
+#    ifdef SPLIT_TRANSPORT_NOTIFY
+    // The report arrives with the slave notifications
+    bool okay = true;
+#    else  // SPLIT_TRANSPORT_NOTIFY
     static uint32_t last_update = 0;
-    static uint16_t last_cpi    = 0;
     report_mouse_t  temp_state;
-    uint16_t        temp_cpi;
     bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
     if (okay) pointing_device_set_shared_report(temp_state);
+#    endif // SPLIT_TRANSPORT_NOTIFY
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi && memcmp(&last_cpi, &temp_cpi, sizeof(temp_cpi)) != 0) {
         memcpy(&split_shmem->pointing.cpi, &temp_cpi, sizeof(temp_cpi));
@@ -616,6 +651,7 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     }
     return okay;
 }
+#    endif // SPLIT_TRANSPORT_FRAME
 
 extern const pointing_device_driver_t pointing_device_driver;
 
@@ -663,6 +699,409 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
+////////////////////////////////////////////////////
+// Slave state block
+
+#if defined(SPLIT_TRANSPORT_FRAME) || defined(SPLIT_TRANSPORT_NOTIFY)
+
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+static bool slave_state_has_pointing(void) {
+#        if defined(POINTING_DEVICE_LEFT)
+    return !is_keyboard_left();
+#        elif defined(POINTING_DEVICE_RIGHT)
+    return is_keyboard_left();
+#        else
+    return true;
+#        endif
+}
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
+// Slave: gather the state prepared by the per-feature slave handlers
+static void slave_state_pack(split_slave_state_t *state) {
+    memcpy(state->matrix, split_shmem->smatrix.matrix, sizeof(state->matrix));
+#    ifdef ENCODER_ENABLE
+    memcpy(state->encoders, split_shmem->encoders.state, sizeof(state->encoders));
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    memcpy(&state->pointing, &split_shmem->pointing.report, sizeof(state->pointing));
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+}
+
+// Master: keep a validated state as the last known one, and hand it to the features
+static void slave_state_apply(const split_slave_state_t *state) {
+    memcpy(split_shmem->smatrix.matrix, state->matrix, sizeof(split_shmem->smatrix.matrix));
+#    ifdef ENCODER_ENABLE
+    memcpy(split_shmem->encoders.state, state->encoders, sizeof(split_shmem->encoders.state));
+    encoder_update_raw(split_shmem->encoders.state);
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    if (slave_state_has_pointing()) {
+        memcpy(&split_shmem->pointing.report, &state->pointing, sizeof(split_shmem->pointing.report));
+        pointing_device_set_shared_report(state->pointing);
+    }
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+}
+
+#endif // defined(SPLIT_TRANSPORT_FRAME) || defined(SPLIT_TRANSPORT_NOTIFY)
+
+////////////////////////////////////////////////////
+// Slave notifications
+
+#ifdef SPLIT_TRANSPORT_NOTIFY
+
+#    ifdef SPLIT_TRANSPORT_FRAME
+#        error "SPLIT_TRANSPORT_NOTIFY cannot be combined with SPLIT_TRANSPORT_FRAME"
+#    endif // SPLIT_TRANSPORT_FRAME
+
+#    ifdef USE_I2C
+#        error "SPLIT_TRANSPORT_NOTIFY requires a serial transport"
+#    endif // USE_I2C
+
+#    ifndef SPLIT_TRANSPORT_NOTIFY_POLL_MS
+#        define SPLIT_TRANSPORT_NOTIFY_POLL_MS FORCED_SYNC_THROTTLE_MS
+#    endif // SPLIT_TRANSPORT_NOTIFY_POLL_MS
+
+static uint8_t slave_notify_checksum(const split_slave_notify_t *notify) {
+    return crc8(&notify->state, sizeof(notify->state));
+}
+
+static bool notify_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_update = 0;
+    bool            okay        = true;
+    bool            poll        = timer_elapsed32(last_update) >= SPLIT_TRANSPORT_NOTIFY_POLL_MS;
+
+    if (transport_master_receive_notifications()) {
+        if (slave_notify_checksum(&split_shmem->slave_notify) == split_shmem->slave_notify.checksum) {
+            slave_state_apply(&split_shmem->slave_notify.state);
+            last_update = timer_read32();
+            poll        = false;
+        } else {
+            // A corrupted notification may have carried a change, fetch the state instead
+            poll = true;
+        }
+    }
+
+    if (poll) {
+        split_slave_notify_t notify;
+        okay = transport_read(GET_SLAVE_NOTIFY, &notify, sizeof(notify));
+        okay &= slave_notify_checksum(&notify) == notify.checksum;
+        if (okay) {
+            slave_state_apply(&notify.state);
+            last_update = timer_read32();
+        }
+    }
+
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    return okay;
+}
+
+static void notify_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static split_slave_state_t last_state;
+    static bool                pending = true;
+
+    slave_state_pack(&split_shmem->slave_notify.state);
+    split_shmem->slave_notify.checksum = slave_notify_checksum(&split_shmem->slave_notify);
+    if (pending || memcmp(&last_state, &split_shmem->slave_notify.state, sizeof(last_state)) != 0) {
+        memcpy(&last_state, &split_shmem->slave_notify.state, sizeof(last_state));
+        // If the push fails, retry on the next scan; the master's poll covers a missing link
+        pending = !transport_slave_notify(GET_SLAVE_NOTIFY);
+    }
+}
+
+#    define TRANSACTIONS_NOTIFY_MASTER() TRANSACTION_HANDLER_MASTER(notify)
+#    define TRANSACTIONS_NOTIFY_SLAVE() TRANSACTION_HANDLER_SLAVE(notify)
+#    define TRANSACTIONS_NOTIFY_REGISTRATIONS [GET_SLAVE_NOTIFY] = trans_target2initiator_initializer(slave_notify),
+
+#else // SPLIT_TRANSPORT_NOTIFY
+
+#    define TRANSACTIONS_NOTIFY_SLAVE()
+#    define TRANSACTIONS_NOTIFY_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_NOTIFY
+
+////////////////////////////////////////////////////
+// Combined frame
+
+#ifdef SPLIT_TRANSPORT_FRAME
+
+_Static_assert(sizeof(split_frame_m2s_t) <= UINT8_MAX, "Too many split sync options enabled for SPLIT_TRANSPORT_FRAME");
+_Static_assert(sizeof(split_frame_s2m_t) <= UINT8_MAX, "Split slave data too large for SPLIT_TRANSPORT_FRAME");
+
+enum split_frame_section {
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    FRAME_MASTER_MATRIX,
+#    endif // SPLIT_TRANSPORT_MIRROR
+#    ifndef DISABLE_SYNC_TIMER
+    FRAME_SYNC_TIMER,
+#    endif // DISABLE_SYNC_TIMER
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    FRAME_LAYER_STATE,
+    FRAME_DEFAULT_LAYER_STATE,
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_LED_STATE_ENABLE
+    FRAME_LED_STATE,
+#    endif // SPLIT_LED_STATE_ENABLE
+#    ifdef SPLIT_MODS_ENABLE
+    FRAME_MODS,
+#    endif // SPLIT_MODS_ENABLE
+#    ifdef BACKLIGHT_ENABLE
+    FRAME_BACKLIGHT,
+#    endif // BACKLIGHT_ENABLE
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    FRAME_RGBLIGHT,
+#    endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+#    if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+    FRAME_LED_MATRIX,
+#    endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+    FRAME_RGB_MATRIX,
+#    endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    FRAME_WPM,
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#    if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+    FRAME_OLED,
+#    endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+#    if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+    FRAME_ST7565,
+#    endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    FRAME_POINTING_CPI,
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    NUM_FRAME_SECTIONS
+};
+
+_Static_assert(NUM_FRAME_SECTIONS <= 16, "Too many split frame sections");
+
+#    define frame_section_initializer(member) \
+        { offsetof(split_shared_memory_t, member), sizeof_member(split_shared_memory_t, member) }
+
+// Where each section lives in the shared memory, on both halves
+static const struct {
+    uint16_t offset;
+    uint8_t  size;
+} frame_sections[NUM_FRAME_SECTIONS] = {
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    [FRAME_MASTER_MATRIX] = frame_section_initializer(mmatrix.matrix),
+#    endif // SPLIT_TRANSPORT_MIRROR
+#    ifndef DISABLE_SYNC_TIMER
+    [FRAME_SYNC_TIMER] = frame_section_initializer(sync_timer),
+#    endif // DISABLE_SYNC_TIMER
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    [FRAME_LAYER_STATE]         = frame_section_initializer(layers.layer_state),
+    [FRAME_DEFAULT_LAYER_STATE] = frame_section_initializer(layers.default_layer_state),
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_LED_STATE_ENABLE
+    [FRAME_LED_STATE] = frame_section_initializer(led_state),
+#    endif // SPLIT_LED_STATE_ENABLE
+#    ifdef SPLIT_MODS_ENABLE
+    [FRAME_MODS] = frame_section_initializer(mods),
+#    endif // SPLIT_MODS_ENABLE
+#    ifdef BACKLIGHT_ENABLE
+    [FRAME_BACKLIGHT] = frame_section_initializer(backlight_level),
+#    endif // BACKLIGHT_ENABLE
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    [FRAME_RGBLIGHT] = frame_section_initializer(rgblight_sync),
+#    endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+#    if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+    [FRAME_LED_MATRIX] = frame_section_initializer(led_matrix_sync),
+#    endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+    [FRAME_RGB_MATRIX] = frame_section_initializer(rgb_matrix_sync),
+#    endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    [FRAME_WPM] = frame_section_initializer(current_wpm),
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#    if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+    [FRAME_OLED] = frame_section_initializer(current_oled_state),
+#    endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+#    if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+    [FRAME_ST7565] = frame_section_initializer(current_st7565_state),
+#    endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    [FRAME_POINTING_CPI] = frame_section_initializer(pointing.cpi),
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+};
+
+static uint8_t frame_m2s_checksum(const split_frame_m2s_t *frame) {
+    return crc8(&frame->length, offsetof(split_frame_m2s_t, payload) - offsetof(split_frame_m2s_t, length) + frame->length);
+}
+
+static uint8_t frame_s2m_checksum(const split_frame_s2m_t *response) {
+    return crc8(&response->accepted, sizeof(split_frame_s2m_t) - offsetof(split_frame_s2m_t, accepted));
+}
+
+// Append a section to the frame if the condition holds
+inline static void frame_pack_if(split_frame_m2s_t *frame, uint8_t section, const void *value, bool condition) {
+    if (condition) {
+        memcpy(&frame->payload[frame->length], value, frame_sections[section].size);
+        frame->length += frame_sections[section].size;
+        frame->sections |= (uint16_t)1 << section;
+    }
+}
+
+// Append a section to the frame if it differs from what the slave was last sent, or if forced
+inline static void frame_pack(split_frame_m2s_t *frame, uint8_t section, const void *value, bool force) {
+    frame_pack_if(frame, section, value, force || memcmp(value, split_shmem_offset_ptr(frame_sections[section].offset), frame_sections[section].size) != 0);
+}
+
+// Copy the sections of a frame into the shared memory; nothing is written unless the whole frame is consistent
+static bool frame_unpack(const split_frame_m2s_t *frame) {
+    uint16_t length = 0;
+    for (uint8_t section = 0; section < NUM_FRAME_SECTIONS; section++) {
+        if (frame->sections & ((uint16_t)1 << section)) {
+            length += frame_sections[section].size;
+        }
+    }
+    if (length != frame->length || (frame->sections >> NUM_FRAME_SECTIONS) != 0) {
+        return false;
+    }
+
+    const uint8_t *data = frame->payload;
+    for (uint8_t section = 0; section < NUM_FRAME_SECTIONS; section++) {
+        if (frame->sections & ((uint16_t)1 << section)) {
+            memcpy(split_shmem_offset_ptr(frame_sections[section].offset), data, frame_sections[section].size);
+            data += frame_sections[section].size;
+        }
+    }
+    return true;
+}
+
+static void frame_pack_master(split_frame_m2s_t *frame, matrix_row_t master_matrix[], bool full_sync) {
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    frame_pack(frame, FRAME_MASTER_MATRIX, master_matrix, full_sync);
+#    endif // SPLIT_TRANSPORT_MIRROR
+
+#    ifndef DISABLE_SYNC_TIMER
+    uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
+    frame_pack_if(frame, FRAME_SYNC_TIMER, &sync_timer, full_sync);
+#    endif // DISABLE_SYNC_TIMER
+
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    frame_pack(frame, FRAME_LAYER_STATE, &layer_state, full_sync);
+    frame_pack(frame, FRAME_DEFAULT_LAYER_STATE, &default_layer_state, full_sync);
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+
+#    ifdef SPLIT_LED_STATE_ENABLE
+    uint8_t led_state = host_keyboard_leds();
+    frame_pack(frame, FRAME_LED_STATE, &led_state, full_sync);
+#    endif // SPLIT_LED_STATE_ENABLE
+
+#    ifdef SPLIT_MODS_ENABLE
+    split_mods_sync_t mods;
+    memset(&mods, 0, sizeof(mods));
+    mods.real_mods = get_mods();
+    mods.weak_mods = get_weak_mods();
+#        ifndef NO_ACTION_ONESHOT
+    mods.oneshot_mods = get_oneshot_mods();
+#        endif // NO_ACTION_ONESHOT
+    frame_pack(frame, FRAME_MODS, &mods, full_sync);
+#    endif // SPLIT_MODS_ENABLE
+
+#    ifdef BACKLIGHT_ENABLE
+    uint8_t level = is_backlight_enabled() ? get_backlight_level() : 0;
+    frame_pack(frame, FRAME_BACKLIGHT, &level, full_sync);
+#    endif // BACKLIGHT_ENABLE
+
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    rgblight_syncinfo_t rgblight_sync;
+    rgblight_get_syncinfo(&rgblight_sync);
+    frame_pack_if(frame, FRAME_RGBLIGHT, &rgblight_sync, full_sync || rgblight_sync.status.change_flags != 0);
+#    endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+
+#    if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+    led_matrix_sync_t led_matrix_sync;
+    memset(&led_matrix_sync, 0, sizeof(led_matrix_sync));
+    memcpy(&led_matrix_sync.led_matrix, &led_matrix_eeconfig, sizeof(led_eeconfig_t));
+    led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
+    frame_pack(frame, FRAME_LED_MATRIX, &led_matrix_sync, full_sync);
+#    endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+    rgb_matrix_sync_t rgb_matrix_sync;
+    memset(&rgb_matrix_sync, 0, sizeof(rgb_matrix_sync));
+    memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
+    rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
+    frame_pack(frame, FRAME_RGB_MATRIX, &rgb_matrix_sync, full_sync);
+#    endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    uint8_t current_wpm = get_current_wpm();
+    frame_pack(frame, FRAME_WPM, &current_wpm, full_sync);
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+
+#    if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+    uint8_t current_oled_state = is_oled_on();
+    frame_pack(frame, FRAME_OLED, &current_oled_state, full_sync);
+#    endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+
+#    if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+    uint8_t current_st7565_state = st7565_is_on();
+    frame_pack(frame, FRAME_ST7565, &current_st7565_state, full_sync);
+#    endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    uint16_t cpi = pointing_device_get_shared_cpi();
+    frame_pack_if(frame, FRAME_POINTING_CPI, &cpi, slave_state_has_pointing() && cpi && cpi != split_shmem->pointing.cpi);
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+}
+
+static bool frame_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t   last_full_sync = 0;
+    bool              full_sync      = timer_elapsed32(last_full_sync) >= FORCED_SYNC_THROTTLE_MS;
+    split_frame_m2s_t frame          = {0};
+    split_frame_s2m_t response       = {0};
+
+    frame_pack_master(&frame, master_matrix, full_sync);
+    frame.checksum = frame_m2s_checksum(&frame);
+
+    // Only the used part of the payload needs to go out, the response always comes back whole
+    bool okay = transport_execute_transaction(EXCHANGE_SPLIT_FRAME, &frame, offsetof(split_frame_m2s_t, payload) + frame.length, &response, sizeof(response));
+    if (okay) {
+        okay = response.checksum == frame_s2m_checksum(&response) && response.accepted;
+    }
+    if (okay) {
+        // The slave now holds these values, so the next frame is encoded against them
+        frame_unpack(&frame);
+        if (full_sync) {
+            last_full_sync = timer_read32();
+        }
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+        if (frame.sections & ((uint16_t)1 << FRAME_RGBLIGHT)) {
+            rgblight_clear_change_flags();
+        }
+#    endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+
+        slave_state_apply(&response.state);
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    return okay;
+}
+
+// Runs on the slave within the transaction: stores the master's fields for the per-feature slave handlers to apply, and answers with the slave's latest state
+static void frame_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_frame_m2s_t *frame    = (const split_frame_m2s_t *)initiator2target_buffer;
+    split_frame_s2m_t       *response = (split_frame_s2m_t *)target2initiator_buffer;
+
+    response->accepted = frame->length <= sizeof(frame->payload) && frame->checksum == frame_m2s_checksum(frame) && frame_unpack(frame);
+    slave_state_pack(&response->state);
+    response->checksum = frame_s2m_checksum(response);
+}
+
+// clang-format off
+#    define TRANSACTIONS_FRAME_MASTER() TRANSACTION_HANDLER_MASTER(frame)
+#    define TRANSACTIONS_FRAME_REGISTRATIONS \
+    [EXCHANGE_SPLIT_FRAME] = { sizeof_member(split_shared_memory_t, frame_m2s), offsetof(split_shared_memory_t, frame_m2s), sizeof_member(split_shared_memory_t, frame_s2m), offsetof(split_shared_memory_t, frame_s2m), frame_slave_callback },
+// clang-format on
+
+#else // SPLIT_TRANSPORT_FRAME
+
+#    define TRANSACTIONS_FRAME_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_FRAME
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -689,6 +1128,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_OLED_REGISTRATIONS
     TRANSACTIONS_ST7565_REGISTRATIONS
     TRANSACTIONS_POINTING_REGISTRATIONS
+    TRANSACTIONS_FRAME_REGISTRATIONS
+    TRANSACTIONS_NOTIFY_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -700,9 +1141,18 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#if defined(SPLIT_TRANSPORT_FRAME)
+    // Everything is exchanged in a single round trip
+    TRANSACTIONS_FRAME_MASTER();
+#else // defined(SPLIT_TRANSPORT_FRAME)
+#    if defined(SPLIT_TRANSPORT_NOTIFY)
+    // The slave pushes its state, only poll if it has been quiet for too long
+    TRANSACTIONS_NOTIFY_MASTER();
+#    else  // defined(SPLIT_TRANSPORT_NOTIFY)
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
-    TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
+#    endif // defined(SPLIT_TRANSPORT_NOTIFY)
+    TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_SYNC_TIMER_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
@@ -715,6 +1165,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_OLED_MASTER();
     TRANSACTIONS_ST7565_MASTER();
     TRANSACTIONS_POINTING_MASTER();
+#endif // defined(SPLIT_TRANSPORT_FRAME)
     return true;
 }
 
@@ -734,6 +1185,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_OLED_SLAVE();
     TRANSACTIONS_ST7565_SLAVE();
     TRANSACTIONS_POINTING_SLAVE();
+    TRANSACTIONS_NOTIFY_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
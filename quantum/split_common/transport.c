@@ -119,6 +119,16 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SPLIT_TRANSPORT_NOTIFY
+bool transport_slave_notify(int8_t id) {
+    return soft_serial_target_notify(id);
+}
+
+bool transport_master_receive_notifications(void) {
+    return soft_serial_initiator_receive_notifications();
+}
+#    endif // SPLIT_TRANSPORT_NOTIFY
+
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -40,6 +40,13 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SPLIT_TRANSPORT_NOTIFY
+// slave: pushes the target2initiator buffer of the transaction to the master, with the shared memory locked
+bool transport_slave_notify(int8_t id);
+// master: receives any pushed buffers; returns true if at least one arrived since the last call
+bool transport_master_receive_notifications(void);
+#endif // SPLIT_TRANSPORT_NOTIFY
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -122,6 +129,99 @@ typedef struct _rpc_sync_info_t {
 } rpc_sync_info_t;
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+#if defined(SPLIT_TRANSPORT_FRAME) || defined(SPLIT_TRANSPORT_NOTIFY)
+// Everything the master reads from the slave, as a single block
+typedef struct _split_slave_state_t {
+    matrix_row_t matrix[(MATRIX_ROWS) / 2];
+#    ifdef ENCODER_ENABLE
+    uint8_t encoders[NUM_ENCODERS_MAX_PER_SIDE];
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    report_mouse_t pointing;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_slave_state_t;
+#endif // defined(SPLIT_TRANSPORT_FRAME) || defined(SPLIT_TRANSPORT_NOTIFY)
+
+#ifdef SPLIT_TRANSPORT_NOTIFY
+// Pushed by the slave whenever its state changes, and polled by the master as a fallback
+typedef struct _split_slave_notify_t {
+    uint8_t             checksum;
+    split_slave_state_t state;
+} split_slave_notify_t;
+#endif // SPLIT_TRANSPORT_NOTIFY
+
+#ifdef SPLIT_TRANSPORT_FRAME
+// Every field the master may put into a combined frame; only used to size the frame payload
+typedef struct _split_frame_fields_t {
+#    ifdef SPLIT_TRANSPORT_MIRROR
+    split_master_matrix_sync_t mmatrix;
+#    endif // SPLIT_TRANSPORT_MIRROR
+
+#    ifndef DISABLE_SYNC_TIMER
+    uint32_t sync_timer;
+#    endif // DISABLE_SYNC_TIMER
+
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    split_layers_sync_t layers;
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+
+#    ifdef SPLIT_LED_STATE_ENABLE
+    uint8_t led_state;
+#    endif // SPLIT_LED_STATE_ENABLE
+
+#    ifdef SPLIT_MODS_ENABLE
+    split_mods_sync_t mods;
+#    endif // SPLIT_MODS_ENABLE
+
+#    ifdef BACKLIGHT_ENABLE
+    uint8_t backlight_level;
+#    endif // BACKLIGHT_ENABLE
+
+#    if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+    rgblight_syncinfo_t rgblight_sync;
+#    endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+
+#    if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+    led_matrix_sync_t led_matrix_sync;
+#    endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+    rgb_matrix_sync_t rgb_matrix_sync;
+#    endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    uint8_t current_wpm;
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+
+#    if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+    uint8_t current_oled_state;
+#    endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
+
+#    if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+    uint8_t current_st7565_state;
+#    endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
+
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    uint16_t pointing_cpi;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_frame_fields_t;
+
+// Master to slave: the fields that changed since the last acknowledged frame, packed back to back in section order
+typedef struct _split_frame_m2s_t {
+    uint8_t  checksum;
+    uint8_t  length;
+    uint16_t sections;
+    uint8_t  payload[sizeof(split_frame_fields_t)];
+} split_frame_m2s_t;
+
+// Slave to master: the slave's state, every frame
+typedef struct _split_frame_s2m_t {
+    uint8_t             checksum;
+    bool                accepted;
+    split_slave_state_t state;
+} split_frame_s2m_t;
+#endif // SPLIT_TRANSPORT_FRAME
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
@@ -185,6 +285,15 @@ typedef struct _split_shared_memory_t {
     split_slave_pointing_sync_t pointing;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_FRAME
+    split_frame_m2s_t frame_m2s;
+    split_frame_s2m_t frame_s2m;
+#endif // SPLIT_TRANSPORT_FRAME
+
+#ifdef SPLIT_TRANSPORT_NOTIFY
+    split_slave_notify_t slave_notify;
+#endif // SPLIT_TRANSPORT_NOTIFY
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
@@ -0,0 +1,59 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+static bool operator==(const RGB &a, const RGB &b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+TEST(Color, BufferMatchesSingleConversion) {
+    HSV hsv[UINT8_MAX + 1];
+    RGB rgb[UINT8_MAX + 1];
+
+    for (int h = 0; h <= UINT8_MAX; h++) {
+        for (int s = 0; s <= UINT8_MAX; s++) {
+            for (int v = 0; v <= UINT8_MAX; v++) {
+                hsv[v] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+
+            hsv_to_rgb_buffer(hsv, rgb, UINT8_MAX + 1);
+            for (int v = 0; v <= UINT8_MAX; v++) {
+                ASSERT_TRUE(rgb[v] == hsv_to_rgb(hsv[v])) << "h " << h << " s " << s << " v " << v;
+            }
+
+            hsv_to_rgb_nocie_buffer(hsv, rgb, UINT8_MAX + 1);
+            for (int v = 0; v <= UINT8_MAX; v++) {
+                ASSERT_TRUE(rgb[v] == hsv_to_rgb_nocie(hsv[v])) << "h " << h << " s " << s << " v " << v;
+            }
+        }
+    }
+}
+
+TEST(Color, EmptyBuffer) {
+    RGB rgb;
+    rgb.r = 1;
+    rgb.g = 2;
+    rgb.b = 3;
+    hsv_to_rgb_buffer(nullptr, &rgb, 0);
+    EXPECT_EQ(rgb.r, 1);
+    EXPECT_EQ(rgb.g, 2);
+    EXPECT_EQ(rgb.b, 3);
+}
@@ -0,0 +1,6 @@
+color_DEFS := -DUSE_CIE1931_CURVE
+
+color_SRC := \
+	$(QUANTUM_PATH)/tests/color_tests.cpp \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/led_tables.c
@@ -113,6 +113,10 @@ void via_init(void) {
     if (!via_eeprom_is_valid()) {
         eeconfig_init_via();
     }
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+#endif
 }
 
 void eeconfig_init_via(void) {
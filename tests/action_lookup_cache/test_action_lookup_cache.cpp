@@ -0,0 +1,145 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ActionLookupCache : public TestFixture {
+   public:
+    void SetUp() override {
+        action_lookup_cache_clear_stats();
+    }
+
+    void TearDown() override {
+        keymap_config.raw = 0;
+        layer_clear();
+    }
+
+    action_t action_for(keypos_t key) {
+        return layer_switch_get_action(key);
+    }
+};
+
+TEST_F(ActionLookupCache, ResolvesThroughTransparentKeys) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_layer = KeymapKey(0, 1, 0, MO(1));
+    auto       key_a     = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_layer, key_a, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(2, 0, 0, KC_B)});
+
+    key_layer.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    key_a.press();
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    key_a.release();
+    key_layer.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 2);
+    EXPECT_EQ(action_for(key_a.position).code, ACTION_KEY(KC_B));
+}
+
+TEST_F(ActionLookupCache, RepeatedLookupsHitTheCache) {
+    auto key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(action_for(key_a.position).code, ACTION_KEY(KC_A));
+    }
+    action_lookup_cache_stats_t stats = action_lookup_cache_get_stats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 2);
+}
+
+TEST_F(ActionLookupCache, LayerStatesKeepTheirOwnEntries) {
+    auto key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key, KeymapKey(1, 0, 0, KC_B)});
+
+    EXPECT_EQ(action_for(key.position).code, ACTION_KEY(KC_A));
+    layer_on(1);
+    EXPECT_EQ(action_for(key.position).code, ACTION_KEY(KC_B));
+    layer_off(1);
+    EXPECT_EQ(action_for(key.position).code, ACTION_KEY(KC_A));
+    layer_on(1);
+    EXPECT_EQ(action_for(key.position).code, ACTION_KEY(KC_B));
+
+    action_lookup_cache_stats_t stats = action_lookup_cache_get_stats();
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.hits, 2);
+}
+
+TEST_F(ActionLookupCache, KeymapConfigChangeInvalidates) {
+    auto key = KeymapKey(0, 0, 0, KC_LEFT_CTRL);
+    set_keymap({key});
+
+    EXPECT_EQ(action_for(key.position).code, ACTION_KEY(KC_LEFT_CTRL));
+    keymap_config.swap_lctl_lgui = true;
+    EXPECT_EQ(action_for(key.position).code, ACTION_KEY(KC_LEFT_GUI));
+    keymap_config.swap_lctl_lgui = false;
+    EXPECT_EQ(action_for(key.position).code, ACTION_KEY(KC_LEFT_CTRL));
+}
+
+TEST_F(ActionLookupCache, InvalidateDropsEntries) {
+    auto key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    action_for(key.position);
+    action_lookup_cache_invalidate();
+    action_for(key.position);
+
+    action_lookup_cache_stats_t stats = action_lookup_cache_get_stats();
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.hits, 0);
+}
+
+TEST_F(ActionLookupCache, ReleaseUsesLayerOfPress) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_layer = KeymapKey(0, 1, 0, MO(1));
+    auto       key       = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_layer, key, KeymapKey(1, 0, 0, KC_B)});
+
+    key_layer.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    key.press();
+    EXPECT_REPORT(driver, (KC_B));
+    run_one_scan_loop();
+
+    key_layer.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,27 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "test_common.h"
+
+/* Every pair of 16 keys is a combo. */
+#define COMBO_COUNT 120
+#define COMBO_KEYCODE_INDEX
+#define COMBO_KEYCODE_INDEX_SIZE 256
+
+/* eeconfig writes past the default 32 bytes of the test EEPROM. */
+#define TOTAL_EEPROM_BYTE_COUNT 64
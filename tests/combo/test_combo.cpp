@@ -0,0 +1,149 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+#define COMBO_KEYS 16
+
+extern "C" {
+combo_t key_combos[COMBO_COUNT];
+}
+
+static uint16_t combo_keys[COMBO_COUNT][3];
+
+static uint16_t combo_index(uint8_t first, uint8_t second) {
+    uint16_t index = 0;
+    for (uint8_t i = 0; i < first; i++) {
+        index += COMBO_KEYS - 1 - i;
+    }
+    return index + second - first - 1;
+}
+
+static uint16_t combo_keycode(uint16_t index) {
+    return KC_F1 + index % 12;
+}
+
+/* Every pair of the keys KC_A to KC_P is a combo, which makes every key part
+ * of 15 combos. The table is filled before the first key event builds the
+ * keycode index. */
+static bool combos_initialized = [] {
+    for (uint8_t first = 0; first < COMBO_KEYS; first++) {
+        for (uint8_t second = first + 1; second < COMBO_KEYS; second++) {
+            uint16_t index           = combo_index(first, second);
+            combo_keys[index][0]     = KC_A + first;
+            combo_keys[index][1]     = KC_A + second;
+            combo_keys[index][2]     = COMBO_END;
+            key_combos[index].keys    = combo_keys[index];
+            key_combos[index].keycode = combo_keycode(index);
+        }
+    }
+    return true;
+}();
+
+class Combo : public TestFixture {
+   public:
+    void SetUp() override {
+        ASSERT_TRUE(combos_initialized);
+        for (uint8_t i = 0; i < COMBO_KEYS; i++) {
+            keys.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i));
+        }
+        keys.push_back(KeymapKey(0, 0, 3, KC_Z));
+        for (auto &key : keys) {
+            add_key(key);
+        }
+    }
+
+    void tap_combo(uint8_t first, uint8_t second) {
+        keys[first].press();
+        run_one_scan_loop();
+        keys[second].press();
+        idle_for(COMBO_TERM + 1);
+        keys[first].release();
+        keys[second].release();
+        idle_for(2);
+    }
+
+    std::vector<KeymapKey> keys;
+};
+
+TEST_F(Combo, FirstComboTriggers) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (combo_keycode(combo_index(0, 1))));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(0, 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(Combo, CombosAcrossRowsTrigger) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (combo_keycode(combo_index(3, 12))));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(3, 12);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(Combo, LastComboTriggers) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (combo_keycode(combo_index(14, 15))));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo(14, 15);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(Combo, SingleComboKeyIsSentAfterComboTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_c = keys[2];
+
+    key_c.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (key_c.report_code));
+    idle_for(COMBO_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    key_c.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(Combo, KeyOutsideOfCombosIsNotDelayed) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_z = keys[COMBO_KEYS];
+
+    key_z.press();
+    EXPECT_REPORT(driver, (key_z.report_code));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    key_z.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,272 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+struct Invocation {
+    uint32_t now;
+    uint32_t trigger_time;
+};
+
+struct Executor {
+    std::vector<Invocation> invocations;
+    uint32_t                period  = 0;
+    uint32_t                repeats = 0;
+};
+
+static std::vector<Executor *> invocation_order;
+
+static uint32_t record_invocation(uint32_t trigger_time, void *cb_arg) {
+    Executor *executor = (Executor *)cb_arg;
+    executor->invocations.push_back({timer_read32(), trigger_time});
+    invocation_order.push_back(executor);
+    if (executor->repeats == 0) {
+        return 0;
+    }
+    executor->repeats--;
+    return executor->period;
+}
+
+class DeferredExec : public TestFixture {
+   public:
+    void SetUp() override {
+        invocation_order.clear();
+        std::fill(std::begin(table), std::end(table), deferred_executor_t{});
+        last_execution_time = timer_read32();
+        start               = timer_read32();
+    }
+
+    void run_for(uint32_t ms, uint32_t step = 1) {
+        for (uint32_t elapsed = 0; elapsed < ms; elapsed += step) {
+            advance_time(step);
+            deferred_exec_advanced_task(table, MAX_DEFERRED_EXECUTORS, &last_execution_time);
+        }
+    }
+
+    deferred_executor_t table[MAX_DEFERRED_EXECUTORS];
+    uint32_t            last_execution_time;
+    uint32_t            start;
+};
+
+TEST_F(DeferredExec, ExecutesAtTriggerTime) {
+    Executor executor;
+
+    EXPECT_NE(defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 10, record_invocation, &executor), INVALID_DEFERRED_TOKEN);
+    run_for(9);
+    EXPECT_TRUE(executor.invocations.empty());
+    run_for(100);
+    ASSERT_EQ(executor.invocations.size(), 1);
+    EXPECT_EQ(executor.invocations[0].now, start + 10);
+    EXPECT_EQ(executor.invocations[0].trigger_time, start + 10);
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToTriggerTime) {
+    Executor executor;
+    executor.period  = 7;
+    executor.repeats = 4;
+
+    defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 10, record_invocation, &executor);
+    run_for(100);
+    ASSERT_EQ(executor.invocations.size(), 5);
+    for (uint32_t i = 0; i < 5; i++) {
+        EXPECT_EQ(executor.invocations[i].trigger_time, start + 10 + 7 * i);
+        EXPECT_EQ(executor.invocations[i].now, start + 10 + 7 * i);
+    }
+}
+
+TEST_F(DeferredExec, ExtendPostponesExecution) {
+    Executor       executor;
+    deferred_token token = defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 10, record_invocation, &executor);
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, MAX_DEFERRED_EXECUTORS, token, 20));
+    run_for(100);
+    ASSERT_EQ(executor.invocations.size(), 1);
+    EXPECT_EQ(executor.invocations[0].now, start + 25);
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, MAX_DEFERRED_EXECUTORS, token, 20));
+}
+
+TEST_F(DeferredExec, CancelPreventsExecution) {
+    Executor       first, second;
+    deferred_token first_token  = defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 10, record_invocation, &first);
+    deferred_token second_token = defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 20, record_invocation, &second);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, MAX_DEFERRED_EXECUTORS, first_token));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, MAX_DEFERRED_EXECUTORS, first_token));
+    run_for(100);
+    EXPECT_TRUE(first.invocations.empty());
+    ASSERT_EQ(second.invocations.size(), 1);
+    EXPECT_EQ(second.invocations[0].now, start + 20);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, MAX_DEFERRED_EXECUTORS, second_token));
+}
+
+TEST_F(DeferredExec, TokensAreUniqueUntilTableIsFull) {
+    Executor                 executor;
+    std::set<deferred_token> tokens;
+
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        deferred_token token = defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 1000, record_invocation, &executor);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        tokens.insert(token);
+    }
+    EXPECT_EQ(tokens.size(), MAX_DEFERRED_EXECUTORS);
+    EXPECT_EQ(defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 1000, record_invocation, &executor), INVALID_DEFERRED_TOKEN);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, MAX_DEFERRED_EXECUTORS, *tokens.begin()));
+    EXPECT_NE(defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 1000, record_invocation, &executor), INVALID_DEFERRED_TOKEN);
+
+    for (auto token : tokens) {
+        cancel_deferred_exec_advanced(table, MAX_DEFERRED_EXECUTORS, token);
+    }
+}
+
+TEST_F(DeferredExec, ExecutesInTriggerTimeOrder) {
+    std::vector<Executor> executors(MAX_DEFERRED_EXECUTORS);
+    std::vector<uint32_t> delays;
+    for (uint32_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        delays.push_back(1 + (i * 13) % MAX_DEFERRED_EXECUTORS);
+    }
+
+    for (uint32_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        EXPECT_NE(defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, delays[i], record_invocation, &executors[i]), INVALID_DEFERRED_TOKEN);
+    }
+    run_for(MAX_DEFERRED_EXECUTORS + 1);
+
+    ASSERT_EQ(invocation_order.size(), MAX_DEFERRED_EXECUTORS);
+    for (uint32_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        ASSERT_EQ(executors[i].invocations.size(), 1);
+        EXPECT_EQ(executors[i].invocations[0].now, start + delays[i]);
+        EXPECT_EQ(invocation_order[delays[i] - 1], &executors[i]);
+    }
+}
+
+static deferred_executor_t *reentrant_table;
+static deferred_token       reentrant_victim;
+
+static uint32_t cancel_and_requeue(uint32_t trigger_time, void *cb_arg) {
+    cancel_deferred_exec_advanced(reentrant_table, MAX_DEFERRED_EXECUTORS, reentrant_victim);
+    defer_exec_advanced(reentrant_table, MAX_DEFERRED_EXECUTORS, 1, record_invocation, cb_arg);
+    return 0;
+}
+
+TEST_F(DeferredExec, CallbackMayModifyTable) {
+    Executor victim, follow_up;
+
+    reentrant_table  = table;
+    reentrant_victim = defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 20, record_invocation, &victim);
+    defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 10, cancel_and_requeue, &follow_up);
+    run_for(100);
+
+    EXPECT_TRUE(victim.invocations.empty());
+    ASSERT_EQ(follow_up.invocations.size(), 1);
+    EXPECT_EQ(follow_up.invocations[0].now, start + 11);
+}
+
+TEST_F(DeferredExec, LoadWithManyRepeatingExecutors) {
+    const uint32_t        duration = 10000;
+    std::vector<Executor> executors(MAX_DEFERRED_EXECUTORS);
+
+    for (uint32_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        executors[i].period  = i + 1;
+        executors[i].repeats = UINT32_MAX;
+        EXPECT_NE(defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, executors[i].period, record_invocation, &executors[i]), INVALID_DEFERRED_TOKEN);
+    }
+    run_for(duration);
+
+    for (uint32_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        ASSERT_EQ(executors[i].invocations.size(), duration / executors[i].period) << "period " << executors[i].period;
+        for (uint32_t n = 0; n < executors[i].invocations.size(); n++) {
+            EXPECT_EQ(executors[i].invocations[n].trigger_time, start + (n + 1) * executors[i].period);
+            EXPECT_EQ(executors[i].invocations[n].now, executors[i].invocations[n].trigger_time);
+        }
+    }
+}
+
+TEST_F(DeferredExec, LateTaskCatchesUpWithTriggerTimes) {
+    const uint32_t        duration = 1000;
+    std::vector<Executor> executors(3);
+
+    for (uint32_t i = 0; i < executors.size(); i++) {
+        executors[i].period  = 10 * (i + 1);
+        executors[i].repeats = UINT32_MAX;
+        defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, executors[i].period, record_invocation, &executors[i]);
+    }
+    run_for(duration, 7);
+
+    for (auto &executor : executors) {
+        ASSERT_GE(executor.invocations.size(), duration / executor.period - 1);
+        for (uint32_t n = 0; n < executor.invocations.size(); n++) {
+            EXPECT_EQ(executor.invocations[n].trigger_time, start + (n + 1) * executor.period);
+            EXPECT_LT(executor.invocations[n].now - executor.invocations[n].trigger_time, 7);
+        }
+    }
+}
+
+TEST_F(DeferredExec, StalledExecutorRunsOncePerPass) {
+    Executor stalled;
+    Executor other;
+    stalled.period  = 5;
+    stalled.repeats = UINT32_MAX;
+
+    defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 5, record_invocation, &stalled);
+    defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 30, record_invocation, &other);
+
+    // Ten periods behind, but each executor only runs once in a single pass
+    run_for(50, 50);
+    ASSERT_EQ(stalled.invocations.size(), 1);
+    ASSERT_EQ(other.invocations.size(), 1);
+    EXPECT_EQ(stalled.invocations[0].trigger_time, start + 5);
+
+    // The following passes catch up one trigger time at a time
+    run_for(3);
+    ASSERT_EQ(stalled.invocations.size(), 4);
+    for (uint32_t n = 0; n < stalled.invocations.size(); n++) {
+        EXPECT_EQ(stalled.invocations[n].trigger_time, start + 5 * (n + 1));
+    }
+}
+
+TEST_F(DeferredExec, PendingExecutorsAreNotInvokedEarly) {
+    Executor executor;
+
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 1000000, record_invocation, &executor);
+    }
+    run_for(10000);
+    EXPECT_TRUE(executor.invocations.empty());
+}
+
+TEST_F(DeferredExec, BasicApi) {
+    Executor       executor;
+    deferred_token token = defer_exec(10, record_invocation, &executor);
+
+    EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_TRUE(extend_deferred_exec(token, 20));
+    for (int i = 0; i < 30; i++) {
+        advance_time(1);
+        deferred_exec_task();
+    }
+    ASSERT_EQ(executor.invocations.size(), 1);
+    EXPECT_EQ(executor.invocations[0].now, start + 20);
+    EXPECT_FALSE(cancel_deferred_exec(token));
+}
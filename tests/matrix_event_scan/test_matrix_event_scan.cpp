@@ -0,0 +1,121 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class MatrixEventScan : public TestFixture {};
+
+TEST_F(MatrixEventScan, AllKeysOfAScanAreProcessedInOnePass) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 3, 0, KC_B);
+    auto       key_c = KeymapKey(0, 1, 2, KC_C);
+
+    set_keymap({key_a, key_b, key_c});
+
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    keyboard_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code));
+    EXPECT_REPORT(driver, (key_c.report_code));
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(MatrixEventScan, ChangesBeyondTheBufferAreProcessedOnTheNextScan) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 0, 1, KC_E);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e});
+
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    key_e.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code, key_d.report_code));
+    keyboard_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (key_a.report_code, key_b.report_code, key_c.report_code, key_d.report_code, key_e.report_code));
+    keyboard_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    key_e.release();
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code, key_d.report_code, key_e.report_code));
+    EXPECT_REPORT(driver, (key_c.report_code, key_d.report_code, key_e.report_code));
+    EXPECT_REPORT(driver, (key_d.report_code, key_e.report_code));
+    EXPECT_REPORT(driver, (key_e.report_code));
+    keyboard_task();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(MatrixEventScan, ModTapChordResolvesWithinOneScan) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    auto       regular_key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({mod_tap_key, regular_key});
+
+    mod_tap_key.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* Both changes are seen by the same scan and share its timestamp. */
+    mod_tap_key.release();
+    regular_key.press();
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (regular_key.report_code));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    regular_key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
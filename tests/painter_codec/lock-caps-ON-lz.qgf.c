@@ -0,0 +1,23 @@
+// Copyright 2022 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was generated from keyboards/tzarc/djinn/graphics/lock-caps-ON.qgf.c, with the pixel data re-encoded using QMK LZ
+
+#include <qp.h>
+
+const uint32_t gfx_lock_caps_ON_lz_length = 145;
+
+// clang-format off
+const uint8_t gfx_lock_caps_ON_lz[145] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x91, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x02, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x61, 0x00, 0x00,
+    0x00, 0x00, 0x84, 0x00, 0x01, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x84, 0x07, 0x00, 0x3F, 0x84,
+    0x07, 0x00, 0xFF, 0x85, 0x07, 0x00, 0x03, 0x84, 0x07, 0x00, 0x0F, 0x84, 0x07, 0x00, 0x3F, 0x81,
+    0x07, 0x01, 0x0F, 0xF0, 0x80, 0x20, 0x84, 0x07, 0x00, 0x03, 0x80, 0x07, 0x00, 0x03, 0x80, 0x07,
+    0x00, 0x0F, 0x81, 0x07, 0x00, 0xC0, 0x80, 0x20, 0x98, 0x07, 0x00, 0xC0, 0x85, 0x07, 0x00, 0x03,
+    0x92, 0x07, 0x80, 0x7C, 0x85, 0x07, 0x00, 0xFC, 0x8A, 0x07, 0x01, 0xF0, 0x0F, 0x82, 0x07, 0x00,
+    0x0F, 0x87, 0x07, 0x00, 0xF0, 0x82, 0x07, 0x00, 0xFC, 0x83, 0x07, 0x83, 0x98, 0xA5, 0x07, 0x85,
+    0xF7,
+};
+// clang-format on
@@ -0,0 +1,11 @@
+// Copyright 2022 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was generated from keyboards/tzarc/djinn/graphics/lock-caps-ON.qgf.c, with the pixel data re-encoded using QMK LZ
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t gfx_lock_caps_ON_lz_length;
+extern const uint8_t  gfx_lock_caps_ON_lz[145];
@@ -0,0 +1,274 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Decodes the sample images and fonts from keyboards/tzarc/djinn onto a mock
+ * panel, and compares a hash of the transferred pixel data against known good
+ * values, so that changes to the decoders can't alter what ends up on screen.
+ * The -lz assets in this directory hold the same pixels re-encoded with LZ,
+ * and have to decode to the same hashes, as does thintel15-unicode, which has
+ * all of its glyphs in the unicode table. */
+
+#include <cstring>
+
+#include "test_common.hpp"
+
+extern "C" {
+// The Quantum Painter headers are C11
+#define _Static_assert static_assert
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+
+#include "keyboards/tzarc/djinn/graphics/djinn.qgf.h"
+#include "keyboards/tzarc/djinn/graphics/lock-caps-ON.qgf.h"
+#include "keyboards/tzarc/djinn/graphics/lock-num-OFF.qgf.h"
+#include "keyboards/tzarc/djinn/graphics/thintel15.qff.h"
+#include "djinn-lz.qgf.h"
+#include "lock-caps-ON-lz.qgf.h"
+#include "thintel15-lz.qff.h"
+#include "thintel15-unicode.qff.h"
+}
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 320
+
+// A 16bpp panel which only hashes the pixel data it receives
+struct mock_panel_t {
+    struct painter_driver_t base;
+
+    uint32_t hash;
+    uint32_t append_calls;
+};
+
+static mock_panel_t panel;
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+extern "C" {
+static bool panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool panel_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool panel_clear(painter_device_t device) {
+    return true;
+}
+
+static bool panel_flush(painter_device_t device) {
+    return true;
+}
+
+static bool panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint16_t window[4] = {left, top, right, bottom};
+    panel.hash         = fnv1a(panel.hash, window, sizeof(window));
+    return true;
+}
+
+static bool panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    panel.hash = fnv1a(panel.hash, pixel_data, native_pixel_count * sizeof(uint16_t));
+    return true;
+}
+
+// Keeps all three components, so that any change in interpolation shows up
+static bool panel_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        qp_pixel_t *pixel = &palette[i];
+        pixel->rgb565     = (pixel->hsv888.h << 8) ^ (pixel->hsv888.s << 4) ^ pixel->hsv888.v;
+    }
+    return true;
+}
+
+static bool panel_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    panel.append_calls++;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        ((uint16_t *)target_buffer)[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+static bool panel_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool panel_comms_start(painter_device_t device) {
+    return true;
+}
+
+static void panel_comms_stop(painter_device_t device) {}
+
+static uint32_t panel_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    return byte_count;
+}
+}
+
+static const struct painter_driver_vtable_t panel_driver_vtable = {panel_init, panel_power, panel_clear, panel_flush, panel_viewport, panel_pixdata, panel_palette_convert, panel_append_pixels};
+static const struct painter_comms_vtable_t  panel_comms_vtable  = {panel_comms_init, panel_comms_start, panel_comms_stop, panel_comms_send};
+
+typedef struct {
+    const char     *name;
+    const uint8_t  *data;
+    const uint32_t *length;
+    uint32_t        hash;
+} image_golden_t;
+
+static const image_golden_t images[] = {
+    {"djinn", gfx_djinn, &gfx_djinn_length, 0x19C1DA5C},
+    {"djinn-lz", gfx_djinn_lz, &gfx_djinn_lz_length, 0x19C1DA5C},
+    {"lock-caps-ON", gfx_lock_caps_ON, &gfx_lock_caps_ON_length, 0x2BAD6DB2},
+    {"lock-caps-ON-lz", gfx_lock_caps_ON_lz, &gfx_lock_caps_ON_lz_length, 0x2BAD6DB2},
+    {"lock-num-OFF", gfx_lock_num_OFF, &gfx_lock_num_OFF_length, 0xA5C37B1A},
+};
+
+static const char *text_sample = "The quick brown fox jumps over the lazy dog 0123456789";
+
+class PainterCodec : public TestFixture {
+   public:
+    void SetUp() override {
+        memset(&panel, 0, sizeof(panel));
+        panel.base.driver_vtable         = &panel_driver_vtable;
+        panel.base.comms_vtable          = &panel_comms_vtable;
+        panel.base.panel_width           = PANEL_WIDTH;
+        panel.base.panel_height          = PANEL_HEIGHT;
+        panel.base.native_bits_per_pixel = 16;
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+        reset();
+    }
+
+    void reset(void) {
+        panel.hash         = 2166136261UL;
+        panel.append_calls = 0;
+        // Stop the palette of the previous draw from being reused
+        qp_internal_invalidate_palette();
+    }
+
+    bool draw_image(const uint8_t *data, bool recolor) {
+        painter_image_handle_t image = qp_load_image_mem(data);
+        if (!image) {
+            return false;
+        }
+        bool ok = recolor ? qp_drawimage_recolor(&panel, 3, 5, image, 170, 255, 255, 43, 128, 32) : qp_drawimage(&panel, 3, 5, image);
+        qp_close_image(image);
+        return ok;
+    }
+
+    bool draw_text(const uint8_t *data, bool recolor, const char *text = text_sample) {
+        painter_font_handle_t font = qp_load_font_mem(data);
+        if (!font) {
+            return false;
+        }
+        int16_t width = recolor ? qp_drawtext_recolor(&panel, 2, 40, font, text, 0, 255, 255, 85, 255, 64) : qp_drawtext(&panel, 2, 40, font, text);
+        qp_close_font(font);
+        return width > 0;
+    }
+};
+
+TEST_F(PainterCodec, ImagesDecodeToGoldenPixels) {
+    for (const auto &image : images) {
+        reset();
+        ASSERT_TRUE(draw_image(image.data, false)) << image.name;
+        EXPECT_EQ(panel.hash, image.hash) << image.name << ": pixel data differs, now 0x" << std::hex << panel.hash;
+    }
+}
+
+TEST_F(PainterCodec, RecoloredImageDecodesToGoldenPixels) {
+    ASSERT_TRUE(draw_image(gfx_djinn, true));
+    EXPECT_EQ(panel.hash, 0x6EC7D928) << "pixel data differs, now 0x" << std::hex << panel.hash;
+}
+
+TEST_F(PainterCodec, TextDecodesToGoldenPixels) {
+    for (const uint8_t *font : {font_thintel15, font_thintel15_lz, font_thintel15_unicode}) {
+        reset();
+        ASSERT_TRUE(draw_text(font, false));
+        EXPECT_EQ(panel.hash, 0xE44C6126) << "pixel data differs, now 0x" << std::hex << panel.hash;
+
+        reset();
+        ASSERT_TRUE(draw_text(font, true));
+        EXPECT_EQ(panel.hash, 0x32126DB1) << "pixel data differs, now 0x" << std::hex << panel.hash;
+    }
+}
+
+TEST_F(PainterCodec, UnicodeGlyphsAreFound) {
+    // U+2190 and U+2192 are copies of '<' and '>', on either side of the ASCII range in the table
+    ASSERT_TRUE(draw_text(font_thintel15_unicode, false, "<a~>"));
+    uint32_t ascii_hash = panel.hash;
+
+    reset();
+    ASSERT_TRUE(draw_text(font_thintel15_unicode, false, "\xE2\x86\x90" "a~" "\xE2\x86\x92"));
+    EXPECT_EQ(panel.hash, ascii_hash);
+
+    // Code points missing from the font fail, rather than matching a neighbour
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15_unicode);
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_textwidth(font, "\xE2\x86\x90" "a~" "\xE2\x86\x92"), qp_textwidth(font, "<a~>"));
+    EXPECT_EQ(qp_textwidth(font, "\xE2\x86\x91"), 0);
+    EXPECT_EQ(qp_textwidth(font, "\x1F"), 0);
+    qp_close_font(font);
+}
+
+TEST_F(PainterCodec, RedrawnTextIsUnchanged) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+
+    // Enough redraws, in alternating colors, to cycle any glyph cache through all of its entries
+    uint32_t hashes[2] = {0};
+    for (int i = 0; i < 6; ++i) {
+        reset();
+        bool recolor = i % 2;
+        ASSERT_GT(recolor ? qp_drawtext_recolor(&panel, 2, 40, font, text_sample, 0, 255, 255, 85, 255, 64) : qp_drawtext(&panel, 2, 40, font, text_sample), 0);
+        if (i < 2) {
+            hashes[recolor] = panel.hash;
+        }
+        EXPECT_EQ(panel.hash, hashes[recolor]) << "redraw " << i;
+    }
+    EXPECT_EQ(hashes[0], 0xE44C6126);
+    EXPECT_EQ(hashes[1], 0x32126DB1);
+
+    qp_close_font(font);
+}
+
+#if QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
+TEST_F(PainterCodec, CachedGlyphsAreNotDecodedAgain) {
+    static const char *clock = "12:34";
+
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    ASSERT_GT(qp_drawtext(&panel, 2, 40, font, clock), 0);
+    uint32_t first_hash = panel.hash;
+    EXPECT_GT(panel.append_calls, 0);
+
+    reset();
+    ASSERT_GT(qp_drawtext(&panel, 2, 40, font, clock), 0);
+    EXPECT_EQ(panel.hash, first_hash);
+    EXPECT_EQ(panel.append_calls, 0) << "cached glyphs were decoded again";
+
+    // Different colors are cached separately
+    reset();
+    ASSERT_GT(qp_drawtext_recolor(&panel, 2, 40, font, clock, 0, 255, 255, 85, 255, 64), 0);
+    EXPECT_NE(panel.hash, first_hash);
+    EXPECT_GT(panel.append_calls, 0);
+
+    qp_close_font(font);
+}
+#endif // QUANTUM_PAINTER_NUM_CACHED_GLYPHS > 0
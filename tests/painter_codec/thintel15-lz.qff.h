@@ -0,0 +1,11 @@
+// Copyright 2022 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was generated from keyboards/tzarc/djinn/graphics/thintel15.qff.c, with the pixel data re-encoded using QMK LZ
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t font_thintel15_lz_length;
+extern const uint8_t  font_thintel15_lz[1054];
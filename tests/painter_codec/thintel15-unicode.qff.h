@@ -0,0 +1,11 @@
+// Copyright 2022 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was generated from keyboards/tzarc/djinn/graphics/thintel15.qff.c, with its ASCII glyphs moved into the unicode table, and U+2190/U+2192 added as copies of '<' and '>'
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t font_thintel15_unicode_length;
+extern const uint8_t  font_thintel15_unicode[1263];
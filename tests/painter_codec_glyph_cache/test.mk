@@ -0,0 +1,30 @@
+# Copyright 2022 QMK
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+# The same decoding tests, with the glyph cache enabled
+SRC += \
+    tests/painter_codec/test_painter_codec.cpp \
+    keyboards/tzarc/djinn/graphics/djinn.qgf.c \
+    keyboards/tzarc/djinn/graphics/lock-caps-ON.qgf.c \
+    keyboards/tzarc/djinn/graphics/lock-num-OFF.qgf.c \
+    keyboards/tzarc/djinn/graphics/thintel15.qff.c \
+    tests/painter_codec/djinn-lz.qgf.c \
+    tests/painter_codec/lock-caps-ON-lz.qgf.c \
+    tests/painter_codec/thintel15-lz.qff.c \
+    tests/painter_codec/thintel15-unicode.qff.c
@@ -0,0 +1,267 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include "test_common.hpp"
+
+extern "C" {
+// The Quantum Painter headers are C11
+#define _Static_assert static_assert
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface.h"
+}
+
+#define PANEL_WIDTH 32
+#define PANEL_HEIGHT 16
+
+/* A 16bpp panel in RAM, recording what a surface transfers to it. When the
+ * pixdata buffer is double-buffered, pixel data is only read on the next call
+ * into the panel, the same as an asynchronous transfer would. */
+struct mock_panel_t {
+    struct painter_driver_t base;
+
+    uint16_t gram[PANEL_HEIGHT][PANEL_WIDTH];
+    uint16_t l, t, r, b;
+    uint16_t x, y;
+    uint32_t viewports;
+    uint32_t pixels_sent;
+    uint32_t flushes;
+
+    const uint16_t *pending_data;
+    uint32_t        pending_count;
+};
+
+static mock_panel_t panel;
+
+static void panel_complete_transfer(void) {
+    for (uint32_t i = 0; i < panel.pending_count; ++i) {
+        if (panel.x < PANEL_WIDTH && panel.y < PANEL_HEIGHT) {
+            panel.gram[panel.y][panel.x] = panel.pending_data[i];
+        }
+        if (++panel.x > panel.r) {
+            panel.x = panel.l;
+            panel.y++;
+        }
+    }
+    panel.pixels_sent += panel.pending_count;
+    panel.pending_count = 0;
+}
+
+extern "C" {
+static bool panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool panel_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool panel_clear(painter_device_t device) {
+    return true;
+}
+
+static bool panel_flush(painter_device_t device) {
+    panel_complete_transfer();
+    panel.flushes++;
+    return true;
+}
+
+static bool panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    panel_complete_transfer();
+    panel.l = panel.x = left;
+    panel.t = panel.y = top;
+    panel.r           = right;
+    panel.b           = bottom;
+    panel.viewports++;
+    return true;
+}
+
+static bool panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    panel_complete_transfer();
+    panel.pending_data  = (const uint16_t *)pixel_data;
+    panel.pending_count = native_pixel_count;
+#if !QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    panel_complete_transfer();
+#endif
+    return true;
+}
+
+// Stores the value as the pixel, so grayscale levels can be checked directly
+static bool panel_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        palette[i].rgb565 = palette[i].hsv888.v;
+    }
+    return true;
+}
+
+static bool panel_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        ((uint16_t *)target_buffer)[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+static bool panel_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool panel_comms_start(painter_device_t device) {
+    return true;
+}
+
+static void panel_comms_stop(painter_device_t device) {
+    panel_complete_transfer();
+}
+
+static uint32_t panel_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    return byte_count;
+}
+}
+
+static const struct painter_driver_vtable_t panel_driver_vtable = {panel_init, panel_power, panel_clear, panel_flush, panel_viewport, panel_pixdata, panel_palette_convert, panel_append_pixels};
+static const struct painter_comms_vtable_t  panel_comms_vtable  = {panel_comms_init, panel_comms_start, panel_comms_stop, panel_comms_send};
+
+static uint8_t rgb565_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+static uint8_t mono_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 2)];
+
+class PainterSurface : public TestFixture {
+   public:
+    static painter_device_t rgb565_surface;
+    static painter_device_t mono_surface;
+
+    void SetUp() override {
+        memset(&panel, 0, sizeof(panel));
+        panel.base.driver_vtable         = &panel_driver_vtable;
+        panel.base.comms_vtable          = &panel_comms_vtable;
+        panel.base.panel_width           = PANEL_WIDTH;
+        panel.base.panel_height          = PANEL_HEIGHT;
+        panel.base.native_bits_per_pixel = 16;
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+
+        if (!rgb565_surface) {
+            rgb565_surface = qp_make_surface(PANEL_WIDTH, PANEL_HEIGHT, 16, rgb565_buffer);
+            mono_surface   = qp_make_surface(PANEL_WIDTH, PANEL_HEIGHT, 2, mono_buffer);
+        }
+        ASSERT_NE(rgb565_surface, nullptr);
+        ASSERT_NE(mono_surface, nullptr);
+        ASSERT_TRUE(qp_init(rgb565_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono_surface, QP_ROTATION_0));
+    }
+
+    // Transfers the initial surface contents, then starts counting from scratch
+    void attach(painter_device_t surface) {
+        qp_surface_set_target(surface, &panel, 0, 0);
+        ASSERT_TRUE(qp_flush(surface));
+        EXPECT_EQ(panel.pixels_sent, PANEL_WIDTH * PANEL_HEIGHT);
+        panel.viewports   = 0;
+        panel.pixels_sent = 0;
+        panel.flushes     = 0;
+    }
+};
+
+painter_device_t PainterSurface::rgb565_surface = nullptr;
+painter_device_t PainterSurface::mono_surface   = nullptr;
+
+TEST_F(PainterSurface, FactoryRejectsUnsupportedDepths) {
+    EXPECT_EQ(qp_make_surface(PANEL_WIDTH, PANEL_HEIGHT, 3, mono_buffer), nullptr);
+    EXPECT_EQ(qp_make_surface(PANEL_WIDTH, PANEL_HEIGHT, 24, mono_buffer), nullptr);
+}
+
+TEST_F(PainterSurface, FlushWithoutTargetFails) {
+    qp_surface_set_target(rgb565_surface, NULL, 0, 0);
+    EXPECT_FALSE(qp_flush(rgb565_surface));
+}
+
+TEST_F(PainterSurface, FlushSendsOnlyTheDirtyRegion) {
+    attach(rgb565_surface);
+
+    EXPECT_TRUE(qp_rect(rgb565_surface, 4, 2, 7, 5, 0, 0, 255, true));
+    EXPECT_EQ(panel.pixels_sent, 0);
+    EXPECT_TRUE(qp_flush(rgb565_surface));
+
+    EXPECT_EQ(panel.viewports, 1);
+    EXPECT_EQ(panel.flushes, 1);
+    EXPECT_EQ(panel.pixels_sent, 4 * 4);
+    EXPECT_EQ(panel.l, 4);
+    EXPECT_EQ(panel.t, 2);
+    EXPECT_EQ(panel.r, 7);
+    EXPECT_EQ(panel.b, 5);
+    EXPECT_EQ(panel.gram[2][4], 0xFFFF);
+    EXPECT_EQ(panel.gram[5][7], 0xFFFF);
+    EXPECT_EQ(panel.gram[6][7], 0x0000);
+}
+
+TEST_F(PainterSurface, FlushSendsTheUnionOfDirtyRegions) {
+    attach(rgb565_surface);
+
+    EXPECT_TRUE(qp_setpixel(rgb565_surface, 1, 3, 0, 255, 255));
+    EXPECT_TRUE(qp_setpixel(rgb565_surface, 10, 8, 85, 255, 255));
+    EXPECT_TRUE(qp_flush(rgb565_surface));
+
+    EXPECT_EQ(panel.viewports, 1);
+    EXPECT_EQ(panel.pixels_sent, 10 * 6);
+    EXPECT_EQ(panel.gram[3][1], 0x00F8); // red, byte-swapped RGB565
+    EXPECT_EQ(panel.gram[8][10], 0xE007); // green, byte-swapped RGB565
+}
+
+TEST_F(PainterSurface, FlushWithoutChangesSendsNothing) {
+    attach(rgb565_surface);
+
+    EXPECT_TRUE(qp_flush(rgb565_surface));
+    EXPECT_EQ(panel.viewports, 0);
+    EXPECT_EQ(panel.pixels_sent, 0);
+}
+
+TEST_F(PainterSurface, FlushAppliesTargetPosition) {
+    qp_surface_set_target(rgb565_surface, &panel, 2, 3);
+    EXPECT_TRUE(qp_flush(rgb565_surface));
+    EXPECT_EQ(panel.l, 2);
+    EXPECT_EQ(panel.t, 3);
+    EXPECT_EQ(panel.r, PANEL_WIDTH + 1);
+    EXPECT_EQ(panel.b, PANEL_HEIGHT + 2);
+}
+
+TEST_F(PainterSurface, GrayscaleSurfaceConvertsLevels) {
+    attach(mono_surface);
+
+    EXPECT_TRUE(qp_rect(mono_surface, 0, 0, 2, 0, 0, 0, 255, true));
+    EXPECT_TRUE(qp_setpixel(mono_surface, 1, 1, 0, 0, 128));
+    EXPECT_TRUE(qp_flush(mono_surface));
+
+    EXPECT_EQ(panel.pixels_sent, 3 * 2);
+    EXPECT_EQ(panel.gram[0][0], 255);
+    EXPECT_EQ(panel.gram[0][2], 255);
+    EXPECT_EQ(panel.gram[1][0], 0);
+    EXPECT_EQ(panel.gram[1][1], 170);
+}
+
+TEST_F(PainterSurface, GrayscaleSurfaceTransfersSeveralBuffers) {
+    attach(mono_surface);
+
+    for (uint16_t y = 0; y < PANEL_HEIGHT; ++y) {
+        EXPECT_TRUE(qp_rect(mono_surface, 0, y, PANEL_WIDTH - 1, y, 0, 0, (y % 4) * 85, true));
+    }
+    EXPECT_TRUE(qp_flush(mono_surface));
+
+    EXPECT_EQ(panel.pixels_sent, PANEL_WIDTH * PANEL_HEIGHT);
+    for (uint16_t y = 0; y < PANEL_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < PANEL_WIDTH; ++x) {
+            ASSERT_EQ(panel.gram[y][x], (y % 4) * 85) << "at " << x << "," << y;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Regenerate with the table printed by a failing RgbMatrixEffects.GoldenFrames
+static const effect_golden_t golden_hashes[] = {
+    {"SOLID_COLOR", 0x55BEB6C5},
+    {"ALPHAS_MODS", 0x2268FEC5},
+    {"GRADIENT_UP_DOWN", 0xB99AA6C5},
+    {"GRADIENT_LEFT_RIGHT", 0x7CE5E1C5},
+    {"BREATHING", 0xF15EA689},
+    {"BAND_SAT", 0xB73453B1},
+    {"BAND_VAL", 0xE91F8BD5},
+    {"BAND_PINWHEEL_SAT", 0x6C05775F},
+    {"BAND_PINWHEEL_VAL", 0xAE2C1E99},
+    {"BAND_SPIRAL_SAT", 0xCA1D7170},
+    {"BAND_SPIRAL_VAL", 0x5F56C6C8},
+    {"CYCLE_ALL", 0x487648FD},
+    {"CYCLE_LEFT_RIGHT", 0x740D5991},
+    {"CYCLE_UP_DOWN", 0xA7AAF87D},
+    {"RAINBOW_MOVING_CHEVRON", 0x3688A2EB},
+    {"CYCLE_OUT_IN", 0x11436DA9},
+    {"CYCLE_OUT_IN_DUAL", 0xF566DD8B},
+    {"CYCLE_PINWHEEL", 0x45166B7D},
+    {"CYCLE_SPIRAL", 0xEC8C649B},
+    {"DUAL_BEACON", 0x98FA23DD},
+    {"RAINBOW_BEACON", 0x8257E187},
+    {"RAINBOW_PINWHEELS", 0x7C4518FF},
+    {"RAINDROPS", 0xC4E51EDD},
+    {"JELLYBEAN_RAINDROPS", 0x1641382C},
+    {"HUE_BREATHING", 0x16E397BD},
+    {"HUE_PENDULUM", 0xE0683F9D},
+    {"HUE_WAVE", 0x022BBDD1},
+    {"PIXEL_RAIN", 0x7C53BBFD},
+    {"PIXEL_FLOW", 0x8CF0FDDD},
+    {"PIXEL_FRACTAL", 0x2100B9D5},
+    {"TYPING_HEATMAP", 0xBC966B75},
+    {"DIGITAL_RAIN", 0x7A1AAD35},
+    {"SOLID_REACTIVE_SIMPLE", 0xD78C4521},
+    {"SOLID_REACTIVE", 0x9F612239},
+    {"SOLID_REACTIVE_WIDE", 0xC1F8D566},
+    {"SOLID_REACTIVE_MULTIWIDE", 0x6F13B8DD},
+    {"SOLID_REACTIVE_CROSS", 0x7C26C261},
+    {"SOLID_REACTIVE_MULTICROSS", 0x0FD4C472},
+    {"SOLID_REACTIVE_NEXUS", 0xEB48B1FA},
+    {"SOLID_REACTIVE_MULTINEXUS", 0xAC249C3B},
+    {"SPLASH", 0xFF5E25CC},
+    {"MULTISPLASH", 0xEB5B5FD4},
+    {"SOLID_SPLASH", 0x5A42B691},
+    {"SOLID_MULTISPLASH", 0xE8736F5A},
+};
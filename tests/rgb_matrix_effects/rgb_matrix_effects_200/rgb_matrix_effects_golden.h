@@ -0,0 +1,63 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Regenerate with the table printed by a failing RgbMatrixEffects.GoldenFrames
+static const effect_golden_t golden_hashes[] = {
+    {"SOLID_COLOR", 0x188CCFC5},
+    {"ALPHAS_MODS", 0x27E137C5},
+    {"GRADIENT_UP_DOWN", 0x46EB3FC5},
+    {"GRADIENT_LEFT_RIGHT", 0xC5068DC5},
+    {"BREATHING", 0x4134023D},
+    {"BAND_SAT", 0xADCD3691},
+    {"BAND_VAL", 0x66F17AD1},
+    {"BAND_PINWHEEL_SAT", 0xAB69B457},
+    {"BAND_PINWHEEL_VAL", 0x4BED2793},
+    {"BAND_SPIRAL_SAT", 0xBBA70EED},
+    {"BAND_SPIRAL_VAL", 0x1E30BD8E},
+    {"CYCLE_ALL", 0x3BD45FD5},
+    {"CYCLE_LEFT_RIGHT", 0x299206FD},
+    {"CYCLE_UP_DOWN", 0x1211C40D},
+    {"RAINBOW_MOVING_CHEVRON", 0x13B474BB},
+    {"CYCLE_OUT_IN", 0x0ABB412D},
+    {"CYCLE_OUT_IN_DUAL", 0x9E094FCD},
+    {"CYCLE_PINWHEEL", 0x2289EB59},
+    {"CYCLE_SPIRAL", 0xCED7D3B5},
+    {"DUAL_BEACON", 0x175B63C7},
+    {"RAINBOW_BEACON", 0x97CD6621},
+    {"RAINBOW_PINWHEELS", 0x56E6E8EB},
+    {"RAINDROPS", 0xBEFABF0D},
+    {"JELLYBEAN_RAINDROPS", 0x89772419},
+    {"HUE_BREATHING", 0x09051455},
+    {"HUE_PENDULUM", 0x34FDAC2D},
+    {"HUE_WAVE", 0x7E03C02D},
+    {"PIXEL_RAIN", 0x99C25D1D},
+    {"PIXEL_FLOW", 0xFA81A2ED},
+    {"PIXEL_FRACTAL", 0x5EE57F55},
+    {"TYPING_HEATMAP", 0x161C58C5},
+    {"DIGITAL_RAIN", 0x50E20125},
+    {"SOLID_REACTIVE_SIMPLE", 0x65AF8CA5},
+    {"SOLID_REACTIVE", 0x1A04DED9},
+    {"SOLID_REACTIVE_WIDE", 0xCB2D0144},
+    {"SOLID_REACTIVE_MULTIWIDE", 0x45BE02C7},
+    {"SOLID_REACTIVE_CROSS", 0x5B65C1EE},
+    {"SOLID_REACTIVE_MULTICROSS", 0x60F9CA4A},
+    {"SOLID_REACTIVE_NEXUS", 0x8B922F3C},
+    {"SOLID_REACTIVE_MULTINEXUS", 0x3A6116C8},
+    {"SPLASH", 0xEFC197C9},
+    {"MULTISPLASH", 0x7A99F2B6},
+    {"SOLID_SPLASH", 0xDA34A6FE},
+    {"SOLID_MULTISPLASH", 0xD2FD7181},
+};
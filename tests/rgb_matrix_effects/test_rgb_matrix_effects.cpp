@@ -0,0 +1,202 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Runs every RGB Matrix effect for a fixed number of frames against a mock
+ * driver, and compares a hash of the rendered frames against the hashes in
+ * rgb_matrix_effects_golden.h of the LED count being tested. When an effect
+ * is changed on purpose, the failing test prints the updated table. */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+extern uint16_t rand16seed;
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+typedef struct {
+    const char *name;
+    uint32_t    hash;
+} effect_golden_t;
+
+#include "rgb_matrix_effects_golden.h"
+
+#define TEST_FRAMES 64
+// A key is pressed every this many frames, for the reactive effects
+#define TEST_KEYPRESS_INTERVAL 8
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+// Effects using rand(), whose sequence differs between C libraries
+static const char *libc_random_effects[] = {"DIGITAL_RAIN", "JELLYBEAN_RAINDROPS", "RAINDROPS"};
+
+static uint8_t  led_buffer[DRIVER_LED_TOTAL][3];
+static uint32_t frame_hash;
+static uint32_t frames_flushed;
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+static void test_init(void) {}
+
+static void test_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    led_buffer[index][0] = r;
+    led_buffer[index][1] = g;
+    led_buffer[index][2] = b;
+}
+
+static void test_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < DRIVER_LED_TOTAL; i++) {
+        test_set_color(i, r, g, b);
+    }
+}
+
+static void test_flush(void) {
+    frame_hash = fnv1a(frame_hash, led_buffer, sizeof(led_buffer));
+    frames_flushed++;
+}
+
+extern "C" {
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_init,
+    .set_color     = test_set_color,
+    .set_color_all = test_set_color_all,
+    .flush         = test_flush,
+};
+
+led_config_t g_led_config;
+}
+
+/* The keys are the first LEDs, the remaining ones are underglow. All of them
+ * are spread over a grid of 10 rows, and the first column holds modifiers. */
+static bool led_config_initialized = [] {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            g_led_config.matrix_co[row][col] = row * MATRIX_COLS + col;
+        }
+    }
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        uint8_t col             = i % TEST_LED_COLS;
+        uint8_t row             = i / TEST_LED_COLS;
+        g_led_config.point[i].x = col * 224 / (TEST_LED_COLS - 1);
+        g_led_config.point[i].y = row * 64 / 9;
+        if (i >= MATRIX_ROWS * MATRIX_COLS) {
+            g_led_config.flags[i] = LED_FLAG_UNDERGLOW;
+        } else if (i % MATRIX_COLS == 0) {
+            g_led_config.flags[i] = LED_FLAG_MODIFIER;
+        } else {
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+    }
+    return true;
+}();
+
+class RgbMatrixEffects : public TestFixture {
+   public:
+    void SetUp() override {
+        ASSERT_TRUE(led_config_initialized);
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(32, 255, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+        rgb_matrix_set_flags(LED_FLAG_ALL);
+    }
+
+    // Renders TEST_FRAMES frames of an effect, starting from the same state every time
+    uint32_t run_effect(uint8_t mode) {
+        /* Effects keep timers of their own, so time has to keep moving forward,
+         * even when the test fixture resets the clock. Every run starts a
+         * multiple of 2^20 ms after the previous one, which lets the key hits
+         * of the previous effect expire, and leaves the low 16 bits of the
+         * clock, which are all the effects animate with, the same. */
+        static uint32_t run_start = 0;
+        run_start += 1UL << 20;
+        set_time(run_start);
+        rgb_matrix_task();
+
+        srand(1);
+        rand16seed = 1337;
+        memset(led_buffer, 0, sizeof(led_buffer));
+        rgb_matrix_mode_noeeprom(mode);
+
+        frame_hash     = 2166136261UL;
+        frames_flushed = 0;
+        while (frames_flushed < TEST_FRAMES) {
+            uint32_t frame = frames_flushed;
+            advance_time(1);
+            rgb_matrix_task();
+
+            if (frames_flushed != frame) {
+                if (frames_flushed % TEST_KEYPRESS_INTERVAL == 0) {
+                    uint8_t key = frames_flushed / TEST_KEYPRESS_INTERVAL;
+                    process_rgb_matrix(key % MATRIX_ROWS, (key * 3) % MATRIX_COLS, true);
+                }
+            }
+        }
+        return frame_hash;
+    }
+};
+
+TEST_F(RgbMatrixEffects, GoldenFrames) {
+    std::string table;
+    bool        changed = false;
+
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        const char *name = effect_names[mode];
+        uint32_t    hash = run_effect(mode);
+
+        char line[64];
+        snprintf(line, sizeof(line), "    {\"%s\", 0x%08X},\n", name, hash);
+        table += line;
+
+        const effect_golden_t *golden = std::find_if(std::begin(golden_hashes), std::end(golden_hashes), [&](const effect_golden_t &g) { return strcmp(g.name, name) == 0; });
+        if (golden == std::end(golden_hashes)) {
+            ADD_FAILURE() << name << ": no golden hash";
+            changed = true;
+            continue;
+        }
+#ifndef __GLIBC__
+        if (std::any_of(std::begin(libc_random_effects), std::end(libc_random_effects), [&](const char *random) { return strcmp(random, name) == 0; })) {
+            continue;
+        }
+#endif
+        if (hash != golden->hash) {
+            ADD_FAILURE() << name << ": frames differ from the golden hash";
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        printf("Updated golden hashes for %u LEDs:\n%s", DRIVER_LED_TOTAL, table.c_str());
+    }
+}
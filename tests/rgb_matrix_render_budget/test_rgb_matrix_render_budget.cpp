@@ -0,0 +1,135 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+// Simulated cost of a single LED, charged by the driver whenever an effect sets its colour
+static uint32_t led_cost_ms = 0;
+static uint32_t leds_set    = 0;
+
+static void test_init(void) {}
+
+static void test_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds_set++;
+    advance_time(led_cost_ms);
+}
+
+static void test_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+static void test_flush(void) {}
+
+extern "C" {
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_init,
+    .set_color     = test_set_color,
+    .set_color_all = test_set_color_all,
+    .flush         = test_flush,
+};
+
+// clang-format off
+led_config_t g_led_config = { {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+    { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+    { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+    { 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 }
+}, {
+    {   0,  0 }, {  24,  0 }, {  48,  0 }, {  72,  0 }, {  96,  0 }, { 120,  0 }, { 144,  0 }, { 168,  0 }, { 192,  0 }, { 216,  0 },
+    {   0, 21 }, {  24, 21 }, {  48, 21 }, {  72, 21 }, {  96, 21 }, { 120, 21 }, { 144, 21 }, { 168, 21 }, { 192, 21 }, { 216, 21 },
+    {   0, 42 }, {  24, 42 }, {  48, 42 }, {  72, 42 }, {  96, 42 }, { 120, 42 }, { 144, 42 }, { 168, 42 }, { 192, 42 }, { 216, 42 },
+    {   0, 64 }, {  24, 64 }, {  48, 64 }, {  72, 64 }, {  96, 64 }, { 120, 64 }, { 144, 64 }, { 168, 64 }, { 192, 64 }, { 216, 64 }
+}, {
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+} };
+// clang-format on
+}
+
+class RgbMatrixRenderBudget : public TestFixture {
+   public:
+    void SetUp() override {
+        led_cost_ms = 0;
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    }
+
+    // Runs the RGB task once per millisecond, returns the most LEDs set by a single task run
+    uint32_t run_for(uint32_t ms) {
+        uint32_t most = 0;
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            leds_set = 0;
+            rgb_matrix_task();
+            most = std::max(most, leds_set);
+        }
+        return most;
+    }
+};
+
+TEST_F(RgbMatrixRenderBudget, CheapEffectRendersInOneIteration) {
+    run_for(1000);
+    EXPECT_EQ(rgb_matrix_get_render_stats().led_process_limit, DRIVER_LED_TOTAL);
+    EXPECT_EQ(run_for(1000), DRIVER_LED_TOTAL);
+}
+
+TEST_F(RgbMatrixRenderBudget, LedsPerIterationFollowTheBudget) {
+    led_cost_ms = 1;
+    run_for(2000);
+    EXPECT_EQ(rgb_matrix_get_render_stats().led_process_limit, RGB_MATRIX_RENDER_BUDGET_US / 1000);
+
+    rgb_matrix_clear_render_stats();
+    EXPECT_LE(run_for(2000), RGB_MATRIX_RENDER_BUDGET_US / 1000);
+    EXPECT_EQ(rgb_matrix_get_render_stats().overruns, 0);
+    EXPECT_LE(rgb_matrix_get_render_stats().last_render_us, RGB_MATRIX_RENDER_BUDGET_US);
+}
+
+TEST_F(RgbMatrixRenderBudget, OverrunsShrinkTheIterations) {
+    led_cost_ms = 1;
+    run_for(2000);
+    rgb_matrix_clear_render_stats();
+
+    // The effect got more expensive, the limit of the last frames is now too large
+    led_cost_ms = 3;
+    run_for(5000);
+    EXPECT_GT(rgb_matrix_get_render_stats().overruns, 0);
+    EXPECT_EQ(rgb_matrix_get_render_stats().led_process_limit, 1);
+
+    rgb_matrix_clear_render_stats();
+    EXPECT_EQ(run_for(2000), 1);
+    EXPECT_EQ(rgb_matrix_get_render_stats().overruns, 0);
+}
+
+TEST_F(RgbMatrixRenderBudget, FramesPerSecond) {
+    run_for(3000);
+    // A frame is started at most every RGB_MATRIX_LED_FLUSH_LIMIT ms, plus a few task runs to render and flush it
+    uint16_t fps = rgb_matrix_get_render_stats().fps;
+    EXPECT_LE(fps, 1000 / RGB_MATRIX_LED_FLUSH_LIMIT);
+    EXPECT_GE(fps, 1000 / (RGB_MATRIX_LED_FLUSH_LIMIT + 4));
+
+    // Spreading the frame over more task runs costs frame rate
+    led_cost_ms = 1;
+    run_for(3000);
+    EXPECT_LT(rgb_matrix_get_render_stats().fps, fps);
+}
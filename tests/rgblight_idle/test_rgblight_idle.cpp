@@ -0,0 +1,100 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgblight.h"
+
+void advance_time(uint32_t ms);
+
+static uint32_t frames = 0;
+
+void rgblight_set(void) {
+    frames++;
+}
+
+// Referenced by the default rgblight_call_driver(), unused with a custom rgblight_set()
+void ws2812_setleds(LED_TYPE *ledarray, uint16_t number_of_leds) {}
+}
+
+class RgblightIdle : public TestFixture {
+   public:
+    void SetUp() override {
+        rgblight_enable_noeeprom();
+        rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+        rgblight_unblink_all_but_layer(RGBLIGHT_MAX_LAYERS);
+        rgblight_set_layer_state(0, false);
+        frames = 0;
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            rgblight_task();
+        }
+    }
+};
+
+TEST_F(RgblightIdle, StaticModeHasNoDeadline) {
+    run_for(1000);
+    EXPECT_EQ(rgblight_task_idle_time(), UINT32_MAX);
+    EXPECT_EQ(frames, 0);
+}
+
+TEST_F(RgblightIdle, AnimationStepsAtDeadline) {
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_BREATHING);
+    EXPECT_EQ(rgblight_task_idle_time(), 0);
+
+    rgblight_task();
+    EXPECT_EQ(frames, 1);
+    uint32_t interval = rgblight_task_idle_time();
+    EXPECT_EQ(interval, pgm_read_byte(&RGBLED_BREATHING_INTERVALS[0]));
+
+    run_for(interval - 1);
+    EXPECT_EQ(frames, 1);
+    EXPECT_EQ(rgblight_task_idle_time(), 1);
+    run_for(1);
+    EXPECT_EQ(frames, 2);
+    EXPECT_EQ(rgblight_task_idle_time(), interval);
+
+    run_for(10 * interval);
+    EXPECT_EQ(frames, 12);
+}
+
+TEST_F(RgblightIdle, BlinkTogglesAtDeadline) {
+    rgblight_blink_layer(0, 100);
+    EXPECT_TRUE(rgblight_get_layer_state(0));
+    EXPECT_EQ(rgblight_task_idle_time(), 100);
+
+    run_for(99);
+    EXPECT_TRUE(rgblight_get_layer_state(0));
+    run_for(1);
+    EXPECT_FALSE(rgblight_get_layer_state(0));
+    EXPECT_EQ(rgblight_task_idle_time(), UINT32_MAX);
+}
+
+TEST_F(RgblightIdle, EarliestOfAnimationAndBlink) {
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_BREATHING);
+    rgblight_task();
+    uint32_t interval = rgblight_task_idle_time();
+
+    rgblight_blink_layer(0, interval / 2);
+    EXPECT_EQ(rgblight_task_idle_time(), interval / 2);
+    run_for(interval / 2);
+    EXPECT_FALSE(rgblight_get_layer_state(0));
+    EXPECT_EQ(rgblight_task_idle_time(), interval - interval / 2);
+}
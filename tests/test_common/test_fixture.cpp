@@ -57,6 +57,7 @@ void TestFixture::TearDownTestCase() {}
 
 TestFixture::TestFixture() {
     m_this = this;
+    action_lookup_cache_invalidate();
 }
 
 TestFixture::~TestFixture() {
@@ -99,6 +100,7 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+    action_lookup_cache_invalidate();
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -110,6 +112,7 @@ void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+    action_lookup_cache_invalidate();
     for (auto& key : keys) {
         add_key(key);
     }
@@ -78,6 +78,10 @@ static void keyboard_idle_timer_cb(struct ch_virtual_timer *, void *arg);
 static void keyboard_idle_timer_cb(void *arg);
 #endif
 
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+static void keyboard_report_queue_clear(void);
+#endif
+
 report_keyboard_t keyboard_report_sent = {{0}};
 #ifdef MOUSE_ENABLE
 report_mouse_t mouse_report_blank = {0};
@@ -499,6 +503,9 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
                 }
                 qmkusbConfigureHookI(&drivers.array[i].driver);
             }
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+            keyboard_report_queue_clear();
+#endif
             osalSysUnlockFromISR();
             if (last_suspend_state) {
                 usb_event_queue_enqueue(USB_EVENT_WAKEUP);
@@ -511,6 +518,12 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
             /* Falls into.*/
         case USB_EVENT_RESET:
             usb_event_queue_enqueue(event);
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+            /* transfers in flight are dropped without an IN callback */
+            osalSysLockFromISR();
+            keyboard_report_queue_clear();
+            osalSysUnlockFromISR();
+#endif
             for (int i = 0; i < NUM_USB_DRIVERS; i++) {
                 chSysLockFromISR();
                 /* Disconnection event on suspend.*/
@@ -767,12 +780,109 @@ __attribute__((weak)) void restart_usb_driver(USBDriver *usbp) {
  *                  Keyboard functions
  * ---------------------------------------------------------
  */
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+#    if KEYBOARD_REPORT_QUEUE_SIZE < 2
+#        error "KEYBOARD_REPORT_QUEUE_SIZE must be at least 2"
+#    endif
+
+/* Keyboard reports waiting to be sent IN
+ *
+ * send_keyboard() appends a copy of the report and only starts a transfer if
+ * the endpoint is idle. The IN callback of the endpoint then starts the next
+ * one, so the main loop never waits for the host to poll. The head entry stays
+ * queued while it is transmitted, since the driver reads it from there. If the
+ * queue is full the newest pending report is replaced, so the host always ends
+ * up with the latest state.
+ *
+ * Everything here must be accessed with the system locked. */
+typedef struct {
+    report_keyboard_t report;
+    usbep_t           ep;
+    uint8_t *         data;
+    uint8_t           size;
+} queued_keyboard_report_t;
+
+static queued_keyboard_report_t keyboard_report_queue[KEYBOARD_REPORT_QUEUE_SIZE];
+static uint8_t                  keyboard_report_queue_head  = 0;
+static uint8_t                  keyboard_report_queue_count = 0;
+static bool                     keyboard_report_in_flight   = false;
+
+static void keyboard_report_queue_clear(void) {
+    keyboard_report_queue_head  = 0;
+    keyboard_report_queue_count = 0;
+    keyboard_report_in_flight   = false;
+}
+
+static void keyboard_report_queue_start(USBDriver *usbp) {
+    if (keyboard_report_in_flight || keyboard_report_queue_count == 0) {
+        return;
+    }
+
+    queued_keyboard_report_t *entry = &keyboard_report_queue[keyboard_report_queue_head];
+    if (usbGetTransmitStatusI(usbp, entry->ep)) {
+        /* busy with another report, retried from its IN callback */
+        return;
+    }
+    keyboard_report_in_flight = true;
+    usbStartTransmitI(usbp, entry->ep, entry->data, entry->size);
+}
+
+static void keyboard_report_queue_push(report_keyboard_t *report) {
+    uint8_t index;
+    if (keyboard_report_queue_count < KEYBOARD_REPORT_QUEUE_SIZE) {
+        index = (keyboard_report_queue_head + keyboard_report_queue_count++) % KEYBOARD_REPORT_QUEUE_SIZE;
+    } else {
+        /* full: replace the newest report, which is never the one in flight */
+        index = (keyboard_report_queue_head + KEYBOARD_REPORT_QUEUE_SIZE - 1) % KEYBOARD_REPORT_QUEUE_SIZE;
+    }
+
+    queued_keyboard_report_t *entry = &keyboard_report_queue[index];
+    entry->report                   = *report;
+#    ifdef NKRO_ENABLE
+    if (keymap_config.nkro && keyboard_protocol) { /* NKRO protocol */
+        entry->ep   = SHARED_IN_EPNUM;
+        entry->data = (uint8_t *)&entry->report;
+        entry->size = sizeof(struct nkro_report);
+    } else
+#    endif /* NKRO_ENABLE */
+    {
+        entry->ep = KEYBOARD_IN_EPNUM;
+        if (keyboard_protocol) {
+            entry->data = (uint8_t *)&entry->report;
+            entry->size = KEYBOARD_REPORT_SIZE;
+        } else { /* boot protocol */
+            entry->data = &entry->report.mods;
+            entry->size = 8;
+        }
+    }
+
+    keyboard_report_queue_start(&USB_DRIVER);
+}
+
+/* a report has made it IN on the keyboard or shared endpoint
+ * callback (called from ISR, unlocked state) */
+static void keyboard_report_queue_in_cb(USBDriver *usbp, usbep_t ep) {
+    osalSysLockFromISR();
+    if (keyboard_report_in_flight && keyboard_report_queue[keyboard_report_queue_head].ep == ep) {
+        keyboard_report_in_flight  = false;
+        keyboard_report_queue_head = (keyboard_report_queue_head + 1) % KEYBOARD_REPORT_QUEUE_SIZE;
+        keyboard_report_queue_count--;
+    }
+    keyboard_report_queue_start(usbp);
+    osalSysUnlockFromISR();
+}
+#endif /* KEYBOARD_REPORT_QUEUE_SIZE */
+
 /* keyboard IN callback hander (a kbd report has made it IN) */
 #ifndef KEYBOARD_SHARED_EP
 void kbd_in_cb(USBDriver *usbp, usbep_t ep) {
+#    ifdef KEYBOARD_REPORT_QUEUE_SIZE
+    keyboard_report_queue_in_cb(usbp, ep);
+#    else
     /* STUB */
     (void)usbp;
     (void)ep;
+#    endif
 }
 #endif
 
@@ -833,7 +943,10 @@ void send_keyboard(report_keyboard_t *report) {
         goto unlock;
     }
 
-#ifdef NKRO_ENABLE
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+    keyboard_report_queue_push(report);
+#else /* KEYBOARD_REPORT_QUEUE_SIZE */
+#    ifdef NKRO_ENABLE
     if (keymap_config.nkro && keyboard_protocol) { /* NKRO protocol */
         /* need to wait until the previous packet has made it through */
         /* can rewrite this using the synchronous API, then would wait
@@ -854,7 +967,7 @@ void send_keyboard(report_keyboard_t *report) {
         }
         usbStartTransmitI(&USB_DRIVER, SHARED_IN_EPNUM, (uint8_t *)report, sizeof(struct nkro_report));
     } else
-#endif /* NKRO_ENABLE */
+#    endif /* NKRO_ENABLE */
     {  /* regular protocol */
         /* need to wait until the previous packet has made it through */
         /* busy wait, should be short and not very common */
@@ -880,6 +993,7 @@ void send_keyboard(report_keyboard_t *report) {
         }
         usbStartTransmitI(&USB_DRIVER, KEYBOARD_IN_EPNUM, data, size);
     }
+#endif /* KEYBOARD_REPORT_QUEUE_SIZE */
     keyboard_report_sent = *report;
 
 unlock:
@@ -908,7 +1022,13 @@ void send_mouse(report_mouse_t *report) {
         return;
     }
 
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+    /* Checked again after waking up, as the IN callback may have already
+     * started the next queued keyboard report on a shared endpoint. */
+    while (usbGetTransmitStatusI(&USB_DRIVER, MOUSE_IN_EPNUM)) {
+#else
     if (usbGetTransmitStatusI(&USB_DRIVER, MOUSE_IN_EPNUM)) {
+#endif
         /* Need to either suspend, or loop and call unlock/lock during
          * every iteration - otherwise the system will remain locked,
          * no interrupts served, so USB not going through as well.
@@ -935,9 +1055,13 @@ void send_mouse(report_mouse_t *report) {
 #ifdef SHARED_EP_ENABLE
 /* shared IN callback hander */
 void shared_in_cb(USBDriver *usbp, usbep_t ep) {
+#    ifdef KEYBOARD_REPORT_QUEUE_SIZE
+    keyboard_report_queue_in_cb(usbp, ep);
+#    else
     /* STUB */
     (void)usbp;
     (void)ep;
+#    endif
 }
 #endif
 
@@ -954,7 +1078,13 @@ static void send_extra(uint8_t report_id, uint16_t data) {
         return;
     }
 
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+    /* Checked again after waking up, as the IN callback may have already
+     * started the next queued keyboard report on a shared endpoint. */
+    while (usbGetTransmitStatusI(&USB_DRIVER, SHARED_IN_EPNUM)) {
+#else
     if (usbGetTransmitStatusI(&USB_DRIVER, SHARED_IN_EPNUM)) {
+#endif
         /* Need to either suspend, or loop and call unlock/lock during
          * every iteration - otherwise the system will remain locked,
          * no interrupts served, so USB not going through as well.
@@ -993,7 +1123,13 @@ void send_programmable_button(uint32_t data) {
         return;
     }
 
+#ifdef KEYBOARD_REPORT_QUEUE_SIZE
+    /* Checked again after waking up, as the IN callback may have already
+     * started the next queued keyboard report on a shared endpoint. */
+    while (usbGetTransmitStatusI(&USB_DRIVER, SHARED_IN_EPNUM)) {
+#else
     if (usbGetTransmitStatusI(&USB_DRIVER, SHARED_IN_EPNUM)) {
+#endif
         /* Need to either suspend, or loop and call unlock/lock during
          * every iteration - otherwise the system will remain locked,
          * no interrupts served, so USB not going through as well.